@@ -221,6 +221,13 @@ public:
     }
 };
 
+PLUGIN_DECLARE_API_VERSION();
+
+// Loaded at startup because of the independent overlay; a plugin that only has a tab can use
+// PluginAPI::ACTIVATE_ON_TAB_OPEN so it isn't loaded until the tab is first opened
+PLUGIN_DECLARE_MANIFEST(PluginAPI::ACTIVATE_ON_STARTUP, "Test Plugin", "1.0.0", "Plugin Developer",
+    "Example plugin demonstrating the new plugin system", "Test Tab", 0, "", "");
+
 PLUGIN_EXPORT PluginAPI::IPlugin* CreatePlugin(const PluginAPI::MasterAPI* api) {
     return new TestPlugin(api);
 }
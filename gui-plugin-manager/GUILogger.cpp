@@ -1,6 +1,47 @@
-#include "stdafx.h"
 #include "GUILogger.h"
+#include "../plugin_manager_base/Plugin_Manager_Base_SDK/LogFormat.h"
 #include <filesystem>
+#include <thread>
+#include <algorithm>
+#include <cctype>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+// Builds off Windows too, for tools/GUILoggerBench
+
+// One formatted line, built on the stack (vsnprintf output + timestamp prefix)
+using LogLine = LogFormat::FixedBuffer<2100>;
+
+namespace {
+    void DebugOutput(const char* text) {
+#ifdef _WIN32
+        OutputDebugStringA(text);
+#else
+        (void)text;
+#endif
+    }
+
+    bool IsErrorLine(const char* message) {
+        return strncmp(message, "[ERROR]", 7) == 0;
+    }
+
+#ifdef _WIN32
+    LPTOP_LEVEL_EXCEPTION_FILTER previousCrashFilter = nullptr;
+
+    // Staged lines would otherwise die with the process; the mapped file keeps what reaches it
+    LONG WINAPI FlushOnUnhandledException(EXCEPTION_POINTERS* info) {
+        GUILogger::Get().FlushOnCrash();
+        return previousCrashFilter ? previousCrashFilter(info) : EXCEPTION_CONTINUE_SEARCH;
+    }
+#endif
+}
+
+GUILogger::GUILogger()
+    : ring(std::make_unique<RingEntry[]>(MAX_BUFFER_SIZE)),
+      signatures(std::make_unique<LineSignature[]>(MAX_BUFFER_SIZE)),
+      arena(std::make_unique<char[]>(ARENA_SIZE)) {
+}
 
 void GUILogger::Initialize(const std::string& logPath) {
     std::lock_guard<std::mutex> lock(logMutex);
@@ -11,6 +52,7 @@ void GUILogger::Initialize(const std::string& logPath) {
 
     // Get the directory where the game exe is located
     std::string fullPath = logPath;
+#ifdef _WIN32
     if (logPath.find(':') == std::string::npos && logPath.find("\\\\") != 0) {
         // Relative path - make it relative to the game executable directory
         char exePath[MAX_PATH];
@@ -18,30 +60,48 @@ void GUILogger::Initialize(const std::string& logPath) {
         std::filesystem::path exeDir = std::filesystem::path(exePath).parent_path();
         fullPath = (exeDir / logPath).string();
     }
+#endif
 
-    logFile.open(fullPath, std::ios::trunc);
-    if (!logFile.is_open()) {
+    if (!logFile.Open(fullPath, LOG_CHUNK_SIZE)) {
         char buffer[512];
-        sprintf_s(buffer, "[GUILogger] Failed to open log file: %s\n", fullPath.c_str());
-        OutputDebugStringA(buffer);
+        snprintf(buffer, sizeof(buffer), "[GUILogger] Failed to open log file: %s\n", fullPath.c_str());
+        DebugOutput(buffer);
         return;
     }
 
     initialized = true;
 
     std::string startupMsg = "=== Plugin Manager GUI Log Started ===\n";
-    logFile << startupMsg;
-    logFile.flush();
+    logFile.Append(startupMsg);
 
-    OutputDebugStringA(startupMsg.c_str());
+    DebugOutput(startupMsg.c_str());
+
+    // Detached like our other background threads; the logger is a process-lifetime singleton
+    if (!flusherRunning.exchange(true)) {
+        std::thread(&GUILogger::FlushLoop, this).detach();
+    }
+
+#ifdef _WIN32
+    static bool crashFilterInstalled = false;
+    if (!crashFilterInstalled) {
+        crashFilterInstalled = true;
+        previousCrashFilter = SetUnhandledExceptionFilter(FlushOnUnhandledException);
+    }
+#endif
 }
 
 void GUILogger::Shutdown() {
+    // Stop the flusher and commit what it hasn't yet (no join: this runs under the loader lock)
+    if (flusherRunning.exchange(false)) {
+        WakeFlusher();
+    }
+    FlushNow();
+
     std::lock_guard<std::mutex> lock(logMutex);
 
-    if (logFile.is_open()) {
-        logFile << "=== Plugin Manager GUI Log Ended ===\n";
-        logFile.close();
+    if (logFile.IsOpen()) {
+        logFile.Append("=== Plugin Manager GUI Log Ended ===\n");
+        logFile.Close();
     }
 
     initialized = false;
@@ -54,16 +114,10 @@ void GUILogger::Log(const char* format, ...) {
     vsnprintf(buffer, sizeof(buffer), format, args);
     va_end(args);
 
-    std::string timestamp = GetTimestamp();
-    std::string message = std::string(buffer);
-    std::string fullMessage = "[" + timestamp + "] " + message;
+    LogLine line;
+    LogFormat::FormatGuiLine(line, buffer);
 
-    std::lock_guard<std::mutex> lock(logMutex);
-
-    WriteToFile(fullMessage);
-    AddToBuffer(message);
-
-    OutputDebugStringA(fullMessage.c_str());
+    Stage(line.View(), true, IsErrorLine(buffer));
 }
 
 void GUILogger::LogToFileOnly(const char* format, ...) {
@@ -73,51 +127,260 @@ void GUILogger::LogToFileOnly(const char* format, ...) {
     vsnprintf(buffer, sizeof(buffer), format, args);
     va_end(args);
 
-    std::string timestamp = GetTimestamp();
-    std::string fullMessage = "[" + timestamp + "] " + std::string(buffer);
+    LogLine line;
+    LogFormat::FormatGuiLine(line, buffer);
 
-    std::lock_guard<std::mutex> lock(logMutex);
-    WriteToFile(fullMessage);
+    Stage(line.View(), false, IsErrorLine(buffer));
+}
+
+void GUILogger::SetFlushPolicy(uint32_t intervalMs, size_t thresholdBytes) {
+    flushIntervalMs.store((std::max)(intervalMs, 1u), std::memory_order_relaxed);
+    flushThreshold.store((std::max)(thresholdBytes, static_cast<size_t>(1)), std::memory_order_relaxed);
+}
+
+void GUILogger::Stage(std::string_view line, bool toBuffer, bool urgent) {
+    bool wake;
+    {
+        std::lock_guard<std::mutex> lock(stagingMutex);
+        stagingText.append(line);
+        stagingLines.push_back({ static_cast<uint32_t>(stagingText.size()), toBuffer });
+        wake = stagingText.size() >= flushThreshold.load(std::memory_order_relaxed);
+    }
+
+    // Without a flusher (before Initialize / after Shutdown) commit right away; errors too,
+    // since they are the lines most likely to be followed by a crash
+    if (urgent || !flusherRunning.load(std::memory_order_acquire)) {
+        FlushNow();
+    } else if (wake) {
+        WakeFlusher();
+    }
+}
+
+void GUILogger::WakeFlusher() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        wakeRequested = true;
+    }
+    wakeCondition.notify_one();
+}
+
+void GUILogger::FlushNow() {
+    std::lock_guard<std::mutex> flushLock(flushMutex);
+
+    {
+        // Swapping keeps both buffers' capacity, so steady-state logging doesn't allocate
+        std::lock_guard<std::mutex> lock(stagingMutex);
+        stagingText.swap(flushText);
+        stagingLines.swap(flushLines);
+    }
+    if (flushLines.empty()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(logMutex);
+
+        // Every staged line goes to the file, so the whole batch is one append
+        WriteToFile(flushText);
+
+        uint32_t start = 0;
+        for (const StagedLine& staged : flushLines) {
+            if (staged.toBuffer) {
+                std::string_view line(flushText.data() + start, staged.end - start);
+                AddToBuffer(line);
+                flushDebugText.append(line);
+            }
+            start = staged.end;
+        }
+    }
+
+    if (!flushDebugText.empty()) {
+        DebugOutput(flushDebugText.c_str());
+    }
+
+    flushText.clear();
+    flushLines.clear();
+    flushDebugText.clear();
+}
+
+void GUILogger::FlushOnCrash() {
+    // The flusher holds flushMutex only briefly; a lock held for longer belongs to the crash
+    std::unique_lock<std::mutex> flushLock(flushMutex, std::defer_lock);
+    for (int attempt = 0; !flushLock.try_lock(); ++attempt) {
+        if (attempt == 50) {
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    std::unique_lock<std::mutex> lock(stagingMutex, std::try_to_lock);
+    if (!lock) {
+        return;
+    }
+
+    // MappedLogSink takes concurrent appends, so logMutex (and the Debug Log) are left alone
+    if (initialized && logFile.IsOpen()) {
+        logFile.Append(stagingText);
+    }
+    stagingText.clear();
+    stagingLines.clear();
+}
+
+void GUILogger::FlushLoop() {
+    while (flusherRunning.load(std::memory_order_acquire)) {
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wakeCondition.wait_for(lock, std::chrono::milliseconds(flushIntervalMs.load(std::memory_order_relaxed)),
+                [this]() { return wakeRequested; });
+            wakeRequested = false;
+        }
+        FlushNow();
+    }
+}
+
+void GUILogger::Sync() {
+    FlushNow();
+    logFile.Sync();
 }
 
 void GUILogger::ClearLogBuffer() {
     std::lock_guard<std::mutex> lock(logMutex);
-    logBuffer.clear();
+    firstSequence = endSequence;
+}
+
+void GUILogger::WriteToFile(std::string_view line) {
+    // No per-line flush: mapped pages already belong to the OS and survive a game crash
+    if (initialized && logFile.IsOpen()) {
+        logFile.Append(line);
+    }
+}
+
+void GUILogger::AddToBuffer(std::string_view line) {
+    // One row per entry: drop the trailing newline and cap the length
+    while (!line.empty() && (line.back() == '\n' || line.back() == '\r')) {
+        line.remove_suffix(1);
+    }
+    if (line.size() > MAX_LINE_LENGTH) {
+        line = line.substr(0, MAX_LINE_LENGTH);
+    }
+
+    // Keep the entry contiguous: if it would straddle the arena end, start over at the beginning
+    uint64_t offset = arenaTail;
+    if (offset % ARENA_SIZE + line.size() > ARENA_SIZE) {
+        offset += ARENA_SIZE - offset % ARENA_SIZE;
+    }
+    uint64_t end = offset + line.size();
+
+    // Evict the oldest entries whose text is about to be overwritten (or the ring is full)
+    while (firstSequence < endSequence &&
+           (endSequence - firstSequence == MAX_BUFFER_SIZE ||
+            end - ring[firstSequence % MAX_BUFFER_SIZE].offset > ARENA_SIZE)) {
+        ++firstSequence;
+    }
+
+    char* text = arena.get() + offset % ARENA_SIZE;
+    memcpy(text, line.data(), line.size());
+
+    // Multi-line messages would break the fixed row height the clipper relies on
+    for (size_t i = 0; i < line.size(); ++i) {
+        if (text[i] == '\n' || text[i] == '\r') {
+            text[i] = ' ';
+        }
+    }
+
+    size_t slot = endSequence % MAX_BUFFER_SIZE;
+    ring[slot] = { offset, static_cast<uint32_t>(line.size()) };
+    signatures[slot] = LineSignature();
+    signatures[slot].AddText(std::string_view(text, line.size()));
+    ++endSequence;
+    arenaTail = end;
+}
+
+std::string_view GUILogger::GetLine(uint64_t sequence) const {
+    if (sequence < firstSequence || sequence >= endSequence) {
+        return {};
+    }
+    const RingEntry& entry = ring[sequence % MAX_BUFFER_SIZE];
+    return std::string_view(arena.get() + entry.offset % ARENA_SIZE, entry.length);
 }
 
-void GUILogger::WriteToFile(const std::string& message) {
-    if (initialized && logFile.is_open()) {
-        logFile << message;
-        if (message.back() != '\n') {
-            logFile << '\n';
+void GUILogger::LineSignature::AddText(std::string_view text) {
+    uint32_t window = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+        window = (window << 8 | static_cast<unsigned char>(std::tolower(static_cast<unsigned char>(text[i])))) & 0xFFFFFF;
+        if (i >= 2) {
+            uint32_t bit = static_cast<uint32_t>((window * 0x9E3779B97F4A7C15ull) >> 56);
+            bits[bit >> 6] |= 1ull << (bit & 63);
         }
-        logFile.flush();
     }
 }
 
-void GUILogger::AddToBuffer(const std::string& message) {
-    LogEntry entry;
-    entry.timestamp = GetTimestamp();
-    entry.message = message;
+namespace {
+    bool ContainsIgnoreCase(std::string_view haystack, std::string_view lowerNeedle) {
+        auto it = std::search(haystack.begin(), haystack.end(), lowerNeedle.begin(), lowerNeedle.end(),
+            [](char a, char b) { return std::tolower(static_cast<unsigned char>(a)) == b; });
+        return it != haystack.end();
+    }
+}
+
+void LogFilter::SetText(std::string_view newText) {
+    if (newText == text) {
+        return;
+    }
+    text.assign(newText);
+
+    terms.clear();
+    termBits = GUILogger::LineSignature();
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t start = text.find_first_not_of(" \t", pos);
+        if (start == std::string::npos) {
+            break;
+        }
+        size_t stop = (std::min)(text.find_first_of(" \t", start), text.size());
+        std::string term = text.substr(start, stop - start);
+        std::transform(term.begin(), term.end(), term.begin(),
+            [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+        termBits.AddText(term);  // terms shorter than 3 characters add no bits
+        terms.push_back(std::move(term));
+        pos = stop;
+    }
 
-    logBuffer.push_back(entry);
+    matches.clear();
+    matchesStart = 0;
+    scannedEnd = 0;
+}
 
-    if (logBuffer.size() > MAX_BUFFER_SIZE) {
-        logBuffer.erase(logBuffer.begin());
+bool LogFilter::Matches(const GUILogger::BufferView& view, uint64_t sequence) const {
+    if (!view.SignatureAt(sequence).Contains(termBits)) {
+        return false;
+    }
+    std::string_view line = view.LineAt(sequence);
+    for (const std::string& term : terms) {
+        if (!ContainsIgnoreCase(line, term)) {
+            return false;
+        }
     }
+    return true;
 }
 
-std::string GUILogger::GetTimestamp() {
-    auto now = std::chrono::system_clock::now();
-    auto time = std::chrono::system_clock::to_time_t(now);
-    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-        now.time_since_epoch()) % 1000;
+void LogFilter::Update(const GUILogger::BufferView& view) {
+    if (!IsActive()) {
+        return;
+    }
 
-    struct tm timeInfo;
-    localtime_s(&timeInfo, &time);
+    // Forget matches that fell out of the ring (or were cleared); compact once they dominate
+    while (matchesStart < matches.size() && matches[matchesStart] < view.FirstSequence()) {
+        ++matchesStart;
+    }
+    if (matchesStart > 4096 && matchesStart * 2 > matches.size()) {
+        matches.erase(matches.begin(), matches.begin() + matchesStart);
+        matchesStart = 0;
+    }
 
-    std::stringstream ss;
-    ss << std::put_time(&timeInfo, "%H:%M:%S")
-       << '.' << std::setfill('0') << std::setw(3) << ms.count();
-    return ss.str();
+    for (uint64_t sequence = (std::max)(scannedEnd, view.FirstSequence()); sequence < view.EndSequence(); ++sequence) {
+        if (Matches(view, sequence)) {
+            matches.push_back(sequence);
+        }
+    }
+    scannedEnd = view.EndSequence();
 }
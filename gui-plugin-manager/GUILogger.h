@@ -1,21 +1,22 @@
 #pragma once
 
+#ifdef _WIN32
 #include <Windows.h>
-#include <fstream>
+#endif
+#include <condition_variable>
 #include <string>
 #include <vector>
+#include <memory>
 #include <mutex>
 #include <chrono>
-#include <sstream>
-#include <iomanip>
+#include <atomic>
+#include <string_view>
+#include <cstdint>
+
+#include "../plugin_manager_base/Plugin_Manager_Base_SDK/MappedLogSink.h"
 
 class GUILogger {
 public:
-    struct LogEntry {
-        std::string timestamp;
-        std::string message;
-    };
-
     static GUILogger& Get() {
         static GUILogger instance;
         return instance;
@@ -26,26 +27,143 @@ public:
     void Log(const char* format, ...);
     void LogToFileOnly(const char* format, ...);
 
-    const std::vector<LogEntry>& GetLogBuffer() const { return logBuffer; }
+    // Log and LogToFileOnly only append to a staging buffer; a background flusher commits it
+    // to the log file and the Debug Log in batches, every intervalMs or once thresholdBytes
+    // are pending, whichever comes first. "[ERROR]" lines are committed before Log returns.
+    void SetFlushPolicy(uint32_t intervalMs, size_t thresholdBytes);
+
+    // Commit everything staged so far, on the calling thread (shutdown paths)
+    void FlushNow();
+
+    // Crash path (the unhandled-exception filter Initialize installs): write staged lines to
+    // the file only, giving up rather than waiting on a lock the crashing thread may hold
+    void FlushOnCrash();
+
+    // FlushNow, then schedule everything logged so far for disk (the log file is memory-mapped)
+    void Sync();
+
+    // 256-bit Bloom signature of the lowercase character trigrams of one line, computed once
+    // when the line is added. A filter term can only occur in a line whose signature contains
+    // all of the term's trigram bits, so most non-matching lines are rejected without a search.
+    struct LineSignature {
+        uint64_t bits[4] = {};
+
+        void AddText(std::string_view text);
+        bool Contains(const LineSignature& other) const {
+            return (bits[0] & other.bits[0]) == other.bits[0] && (bits[1] & other.bits[1]) == other.bits[1] &&
+                   (bits[2] & other.bits[2]) == other.bits[2] && (bits[3] & other.bits[3]) == other.bits[3];
+        }
+    };
+
+    // Locked, read-only view of the Debug Log lines ("[timestamp] message", oldest first).
+    // Holds the logger lock while alive, so keep it to one frame's worth of rendering.
+    // Every line also has a sequence number that never changes; lines in
+    // [FirstSequence(), EndSequence()) are still in the buffer.
+    class BufferView {
+    public:
+        size_t Size() const { return static_cast<size_t>(logger.endSequence - logger.firstSequence); }
+        std::string_view Line(size_t index) const { return logger.GetLine(logger.firstSequence + index); }
+
+        uint64_t FirstSequence() const { return logger.firstSequence; }
+        uint64_t EndSequence() const { return logger.endSequence; }
+        std::string_view LineAt(uint64_t sequence) const { return logger.GetLine(sequence); }
+        const LineSignature& SignatureAt(uint64_t sequence) const { return logger.signatures[sequence % MAX_BUFFER_SIZE]; }
+
+    private:
+        friend class GUILogger;
+        explicit BufferView(GUILogger& owner) : logger(owner), lock(owner.logMutex) {}
+
+        GUILogger& logger;
+        std::unique_lock<std::mutex> lock;
+    };
+
+    BufferView LockBuffer() { return BufferView(*this); }
     void ClearLogBuffer();
 
     bool IsDebugWindowVisible() const { return showDebugWindow; }
     void SetDebugWindowVisible(bool visible) { showDebugWindow = visible; }
 
 private:
-    GUILogger() = default;
+    GUILogger();
     ~GUILogger() { Shutdown(); }
     GUILogger(const GUILogger&) = delete;
     GUILogger& operator=(const GUILogger&) = delete;
 
-    void WriteToFile(const std::string& message);
-    void AddToBuffer(const std::string& message);
-    std::string GetTimestamp();
+    void Stage(std::string_view line, bool toBuffer, bool urgent);
+    void WakeFlusher();
+    void FlushLoop();
+    void WriteToFile(std::string_view line);
+    void AddToBuffer(std::string_view line);
+    std::string_view GetLine(uint64_t sequence) const;
+
+    // Debug Log lines: a fixed ring of entries whose text lives in one circular arena.
+    // Entry n sits in slot n % MAX_BUFFER_SIZE. Arena positions are monotonic byte counts;
+    // an entry never wraps, it skips to the arena start.
+    struct RingEntry {
+        uint64_t offset;
+        uint32_t length;
+    };
 
-    std::ofstream logFile;
-    std::vector<LogEntry> logBuffer;
+    // Staged lines: text is the concatenation, each line records where it ends and
+    // whether it also goes to the Debug Log. Swapped with the flush pair under stagingMutex.
+    struct StagedLine {
+        uint32_t end;
+        bool toBuffer;
+    };
+
+    std::string stagingText;
+    std::vector<StagedLine> stagingLines;
+    std::mutex stagingMutex;
+    std::string flushText;
+    std::vector<StagedLine> flushLines;
+    std::string flushDebugText;
+    std::mutex flushMutex;              // one flush at a time, so batches stay in order
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    bool wakeRequested = false;         // guarded by wakeMutex
+    std::atomic<bool> flusherRunning{ false };
+    std::atomic<uint32_t> flushIntervalMs{ 100 };
+    std::atomic<size_t> flushThreshold{ 64 * 1024 };
+
+    MappedLogSink logFile;
+    std::unique_ptr<RingEntry[]> ring;
+    std::unique_ptr<LineSignature[]> signatures;
+    std::unique_ptr<char[]> arena;
+    uint64_t firstSequence = 0; // oldest entry still in the ring
+    uint64_t endSequence = 0;   // sequence number of the next entry
+    uint64_t arenaTail = 0;     // next write position
     std::mutex logMutex;
     bool initialized = false;
     bool showDebugWindow = false;
-    static constexpr size_t MAX_BUFFER_SIZE = 1000;
+    static constexpr size_t MAX_BUFFER_SIZE = 100000;
+    static constexpr size_t ARENA_SIZE = 16 * 1024 * 1024;
+    static constexpr size_t MAX_LINE_LENGTH = 1024;
+    static constexpr uint64_t LOG_CHUNK_SIZE = 1024 * 1024;
+};
+
+// Incrementally maintained Debug Log filter. A line matches when it contains every
+// whitespace-separated term of the filter text (case-insensitive). Matches are kept as
+// sequence numbers: Update only looks at lines added since the previous call and drops
+// matches that were evicted, so a frame costs O(new lines + visible rows).
+class LogFilter {
+public:
+    // Changing the text resets the index; the next Update rescans the buffer once
+    void SetText(std::string_view text);
+    const std::string& GetText() const { return text; }
+    bool IsActive() const { return !terms.empty(); }
+
+    void Update(const GUILogger::BufferView& view);
+
+    size_t Size() const { return matches.size() - matchesStart; }
+    uint64_t Sequence(size_t index) const { return matches[matchesStart + index]; }
+
+private:
+    bool Matches(const GUILogger::BufferView& view, uint64_t sequence) const;
+
+    std::string text;
+    std::vector<std::string> terms;     // lowercase
+    GUILogger::LineSignature termBits;  // union of all terms' trigrams
+    std::vector<uint64_t> matches;
+    size_t matchesStart = 0;            // matches before this index were evicted
+    uint64_t scannedEnd = 0;            // lines below this sequence were already tested
 };
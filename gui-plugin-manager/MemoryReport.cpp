@@ -0,0 +1,528 @@
+#include "stdafx.h"
+#include "MemoryReport.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include "../plugin_manager_base/Plugin_Manager_Base_SDK/ObjectArray.h"
+#include "../plugin_manager_base/Plugin_Manager_Base_SDK/SDK/SDK.hpp"
+
+namespace {
+
+enum Column {
+    ColumnClass,
+    ColumnCount,
+    ColumnShallow,
+    ColumnHeap,
+    ColumnTotal,
+    ColumnDeltaCount,
+    ColumnDeltaBytes,
+    ColumnNum
+};
+
+// TArray / FString property: { Data, Num, Max } at offset, owning Max * elementSize heap bytes
+struct HeapField {
+    int32_t offset;
+    int32_t elementSize;
+};
+
+struct ClassAccum {
+    int64_t count = 0;
+    int64_t heapBytes = 0;
+    const std::vector<HeapField>* heapFields = nullptr;
+};
+
+// Not a real allocation if Max is beyond this (torn read of an object being destroyed)
+constexpr int32_t MaxSaneElements = 1 << 28;
+
+std::vector<HeapField> HeapFieldsOf(const SDK::UClass* cls) {
+    const uint64_t arrayFlag = static_cast<uint64_t>(SDK::EClassCastFlags::ArrayProperty);
+    const uint64_t stringFlag = static_cast<uint64_t>(SDK::EClassCastFlags::StrProperty);
+
+    std::vector<HeapField> fields;
+    for (const SDK::UStruct* s = cls; s; s = s->Super) {
+        for (SDK::FField* field = s->ChildProperties; field; field = field->Next) {
+            if (!field->ClassPrivate) {
+                continue;
+            }
+            const uint64_t castFlags = static_cast<uint64_t>(field->ClassPrivate->CastFlags);
+            const SDK::FProperty* prop = static_cast<const SDK::FProperty*>(field);
+
+            int32_t elementSize = 0;
+            if (castFlags & arrayFlag) {
+                const SDK::FProperty* inner = static_cast<const SDK::FArrayProperty*>(field)->InnerProperty;
+                elementSize = inner ? inner->ElementSize : 0;
+            } else if (castFlags & stringFlag) {
+                elementSize = sizeof(wchar_t);
+            }
+            if (elementSize <= 0) {
+                continue;
+            }
+            for (int32_t d = 0; d < (std::max)(1, prop->ArrayDim); ++d) {
+                fields.push_back({ prop->Offset + d * prop->ElementSize, elementSize });
+            }
+        }
+    }
+    return fields;
+}
+
+int64_t HeapBytesOf(const SDK::UObject* object, const std::vector<HeapField>& fields) {
+    int64_t bytes = 0;
+    const uint8_t* base = reinterpret_cast<const uint8_t*>(object);
+    for (const HeapField& field : fields) {
+        const void* data;
+        int32_t max;
+        std::memcpy(&data, base + field.offset, sizeof(data));
+        std::memcpy(&max, base + field.offset + sizeof(void*) + sizeof(int32_t), sizeof(max));
+        if (data && max > 0 && max < MaxSaneElements) {
+            bytes += static_cast<int64_t>(max) * field.elementSize;
+        }
+    }
+    return bytes;
+}
+
+std::string FormatBytes(int64_t bytes) {
+    char buffer[32];
+    double value = static_cast<double>(bytes < 0 ? -bytes : bytes);
+    const char* sign = bytes < 0 ? "-" : "";
+    if (value >= 1024.0 * 1024.0) {
+        snprintf(buffer, sizeof(buffer), "%s%.2f MB", sign, value / (1024.0 * 1024.0));
+    } else if (value >= 1024.0) {
+        snprintf(buffer, sizeof(buffer), "%s%.1f KB", sign, value / 1024.0);
+    } else {
+        snprintf(buffer, sizeof(buffer), "%s%lld B", sign, static_cast<long long>(value));
+    }
+    return buffer;
+}
+
+// Class names never contain quotes or commas in practice, but a CSV must not break if one does
+void WriteCsvField(std::ofstream& file, const std::string& text) {
+    if (text.find_first_of(",\"") == std::string::npos) {
+        file << text;
+        return;
+    }
+    file << '"';
+    for (char c : text) {
+        file << c;
+        if (c == '"') {
+            file << '"';
+        }
+    }
+    file << '"';
+}
+
+const MemoryReport::ClassRow* FindRow(const MemoryReport::Report* report, const std::string& className) {
+    if (!report) {
+        return nullptr;
+    }
+    auto it = report->rowByClass.find(className);
+    return it != report->rowByClass.end() ? &report->rows[it->second] : nullptr;
+}
+
+// Deltas only mean something between captures that counted the same bytes: with the heap
+// included, every class with a TArray or FString would otherwise "grow" by its heap blocks
+bool SameKind(const MemoryReport::Report& report, const MemoryReport::Report& baseline) {
+    return report.includesHeap == baseline.includesHeap;
+}
+
+const char* HeapSetting(const MemoryReport::Report& report) {
+    return report.includesHeap ? "with" : "without";
+}
+
+int64_t DeltaCount(const MemoryReport::ClassRow& row, const MemoryReport::Report* baseline) {
+    const MemoryReport::ClassRow* before = FindRow(baseline, row.className);
+    return row.count - (before ? before->count : 0);
+}
+
+int64_t DeltaBytes(const MemoryReport::ClassRow& row, const MemoryReport::Report* baseline) {
+    const MemoryReport::ClassRow* before = FindRow(baseline, row.className);
+    int64_t now = row.shallowBytes + row.heapBytes;
+    return now - (before ? before->shallowBytes + before->heapBytes : 0);
+}
+
+// Display row i: a report row, or past the report's rows a baseline class that vanished since
+// (shown with zero counts and negative deltas, as ExportCSV writes it)
+const MemoryReport::ClassRow& DisplayRow(const MemoryReport::Report& report, const MemoryReport::Report* baseline,
+    const std::vector<size_t>& vanished, size_t i, bool& gone) {
+    gone = i >= report.rows.size();
+    return gone ? baseline->rows[vanished[i - report.rows.size()]] : report.rows[i];
+}
+
+}  // namespace
+
+std::shared_ptr<MemoryReport::Report> MemoryReport::Capture(bool includeHeap, int threads) {
+    auto start = std::chrono::steady_clock::now();
+    if (threads <= 0) {
+        threads = (std::max)(1, static_cast<int>(std::thread::hardware_concurrency()) / 2);
+    }
+
+    using ClassMap = std::unordered_map<const SDK::UClass*, ClassAccum>;
+    using LayoutMap = std::unordered_map<const SDK::UClass*, std::vector<HeapField>>;
+
+    // Chunks are handed out one at a time; each worker aggregates into its own maps
+    const int32_t chunks = ObjectArray::NumChunks();
+    threads = (std::max)(1, (std::min)(threads, static_cast<int>(chunks)));
+    std::atomic<int32_t> nextChunk{ 0 };
+    std::vector<ClassMap> partials(threads);
+    std::vector<LayoutMap> layouts(threads);
+
+    auto work = [&](int t) {
+        ClassMap& classes = partials[t];
+        LayoutMap& layout = layouts[t];
+        for (int32_t c = nextChunk++; c < chunks; c = nextChunk++) {
+            int32_t count = 0;
+            const SDK::FUObjectItem* items = ObjectArray::GetChunk(c, count);
+            for (int32_t i = 0; items && i < count; ++i) {
+                const SDK::UObject* object = items[i].Object;
+                if (!object || !object->Class) {
+                    continue;
+                }
+                ClassAccum& accum = classes[object->Class];
+                ++accum.count;
+                if (!includeHeap) {
+                    continue;
+                }
+                if (!accum.heapFields) {
+                    auto [it, inserted] = layout.try_emplace(object->Class);
+                    if (inserted) {
+                        it->second = HeapFieldsOf(object->Class);
+                    }
+                    accum.heapFields = &it->second;
+                }
+                accum.heapBytes += HeapBytesOf(object, *accum.heapFields);
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; ++t) {
+        workers.emplace_back(work, t);
+    }
+    work(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    ClassMap merged = std::move(partials[0]);
+    for (int t = 1; t < threads; ++t) {
+        for (const auto& [cls, accum] : partials[t]) {
+            ClassAccum& target = merged[cls];
+            target.count += accum.count;
+            target.heapBytes += accum.heapBytes;
+        }
+    }
+
+    // Names once per class; blueprint classes can share a name across packages, so merge by name
+    auto report = std::make_shared<Report>();
+    report->capturedAt = std::time(nullptr);
+    report->includesHeap = includeHeap;
+    for (const auto& [cls, accum] : merged) {
+        std::string name = cls->GetName();
+        auto [it, inserted] = report->rowByClass.try_emplace(name, report->rows.size());
+        if (inserted) {
+            report->rows.push_back({ name });
+        }
+        ClassRow& row = report->rows[it->second];
+        row.count += accum.count;
+        row.shallowBytes += accum.count * cls->Size;
+        row.heapBytes += accum.heapBytes;
+
+        report->totalCount += accum.count;
+        report->totalShallowBytes += accum.count * cls->Size;
+        report->totalHeapBytes += accum.heapBytes;
+    }
+
+    report->captureMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return report;
+}
+
+bool MemoryReport::StartCapture(bool includeHeap, int threads) {
+    if (m_Capturing.exchange(true)) {
+        return false;
+    }
+
+    std::thread([this, includeHeap, threads]() {
+        try {
+            std::shared_ptr<Report> report = Capture(includeHeap, threads);
+            GUILogger::Get().Log("[INFO] [MemoryReport] %lld objects in %zu classes, captured in %.0f ms",
+                static_cast<long long>(report->totalCount), report->rows.size(), report->captureMs);
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Report = std::move(report);
+        } catch (...) {
+            GUILogger::Get().Log("[ERROR] [MemoryReport] Exception during capture");
+        }
+        m_Capturing.store(false, std::memory_order_release);
+    }).detach();
+    return true;
+}
+
+std::shared_ptr<const MemoryReport::Report> MemoryReport::GetReport() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Report;
+}
+
+std::shared_ptr<const MemoryReport::Report> MemoryReport::GetBaseline() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Baseline;
+}
+
+void MemoryReport::SetBaseline(std::shared_ptr<const Report> baseline) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Baseline = std::move(baseline);
+}
+
+std::string MemoryReport::ExportCSV(const std::string& path) const {
+    std::shared_ptr<const Report> report = GetReport();
+    std::shared_ptr<const Report> baseline = GetBaseline();
+    if (!report) {
+        return "";
+    }
+    if (baseline && !SameKind(*report, *baseline)) {
+        GUILogger::Get().Log("[WARNING] [MemoryReport] Baseline was captured %s TArray/FString heap, this capture %s; exporting without deltas",
+            HeapSetting(*baseline), HeapSetting(*report));
+        baseline = nullptr;
+    }
+
+    std::string outPath = path;
+    if (outPath.empty()) {
+        char name[64];
+        std::tm local{};
+        localtime_s(&local, &report->capturedAt);
+        std::strftime(name, sizeof(name), "memory_%Y%m%d_%H%M%S.csv", &local);
+        outPath = "Plugin_Manager/reports/" + std::string(name);
+    }
+
+    std::error_code ec;
+    std::filesystem::path parent = std::filesystem::path(outPath).parent_path();
+    if (!parent.empty()) {
+        std::filesystem::create_directories(parent, ec);
+    }
+    std::ofstream file(outPath, std::ios::trunc);
+    if (!file.is_open()) {
+        GUILogger::Get().Log("[ERROR] [MemoryReport] Could not write %s", outPath.c_str());
+        return "";
+    }
+
+    file << "Class,Count,ShallowBytes,HeapBytes,TotalBytes";
+    if (baseline) {
+        file << ",DeltaCount,DeltaBytes";
+    }
+    file << "\n";
+    for (const ClassRow& row : report->rows) {
+        WriteCsvField(file, row.className);
+        file << ',' << row.count << ',' << row.shallowBytes << ',' << row.heapBytes << ','
+             << (row.shallowBytes + row.heapBytes);
+        if (baseline) {
+            file << ',' << DeltaCount(row, baseline.get()) << ',' << DeltaBytes(row, baseline.get());
+        }
+        file << "\n";
+    }
+
+    // Classes that disappeared since the baseline
+    if (baseline) {
+        for (const ClassRow& row : baseline->rows) {
+            if (!FindRow(report.get(), row.className)) {
+                WriteCsvField(file, row.className);
+                file << ",0,0,0,0," << -row.count << ',' << -(row.shallowBytes + row.heapBytes) << "\n";
+            }
+        }
+    }
+    return outPath;
+}
+
+void MemoryReport::SortRows(const Report& report, const Report* baseline, int column, bool ascending) {
+    m_Vanished.clear();
+    if (baseline) {
+        for (size_t i = 0; i < baseline->rows.size(); ++i) {
+            if (!FindRow(&report, baseline->rows[i].className)) {
+                m_Vanished.push_back(i);
+            }
+        }
+    }
+
+    const size_t rowCount = report.rows.size() + m_Vanished.size();
+    m_Order.clear();
+    m_Order.reserve(rowCount);
+    for (size_t i = 0; i < rowCount; ++i) {
+        bool gone;
+        const ClassRow& row = DisplayRow(report, baseline, m_Vanished, i, gone);
+        if (m_Filter[0] == '\0' || row.className.find(m_Filter) != std::string::npos) {
+            m_Order.push_back(i);
+        }
+    }
+
+    // Sort keys computed once per row, not per comparison
+    std::vector<int64_t> keys(rowCount);
+    for (size_t i : m_Order) {
+        bool gone;
+        const ClassRow& row = DisplayRow(report, baseline, m_Vanished, i, gone);
+        switch (column) {
+        case ColumnCount: keys[i] = gone ? 0 : row.count; break;
+        case ColumnShallow: keys[i] = gone ? 0 : row.shallowBytes; break;
+        case ColumnHeap: keys[i] = gone ? 0 : row.heapBytes; break;
+        case ColumnTotal: keys[i] = gone ? 0 : row.shallowBytes + row.heapBytes; break;
+        case ColumnDeltaCount: keys[i] = gone ? -row.count : DeltaCount(row, baseline); break;
+        case ColumnDeltaBytes: keys[i] = gone ? -(row.shallowBytes + row.heapBytes) : DeltaBytes(row, baseline); break;
+        default: break;
+        }
+    }
+
+    std::sort(m_Order.begin(), m_Order.end(), [&](size_t a, size_t b) {
+        if (column == ColumnClass) {
+            bool goneA, goneB;
+            int cmp = DisplayRow(report, baseline, m_Vanished, a, goneA).className.compare(
+                DisplayRow(report, baseline, m_Vanished, b, goneB).className);
+            return ascending ? cmp < 0 : cmp > 0;
+        }
+        return ascending ? keys[a] < keys[b] : keys[a] > keys[b];
+    });
+}
+
+void MemoryReport::RenderWindow(bool* open) {
+    ImGui::SetNextWindowSize(ImVec2(820, 500), ImGuiCond_FirstUseEver);
+    if (!ImGui::Begin("Memory Report", open)) {
+        ImGui::End();
+        return;
+    }
+
+    std::shared_ptr<const Report> report = GetReport();
+    std::shared_ptr<const Report> baseline = GetBaseline();
+
+    // While there is a baseline, new captures use its heap setting so they can be compared
+    if (baseline) {
+        m_IncludeHeap = baseline->includesHeap;
+    }
+    bool capturing = IsCapturing();
+    ImGui::BeginDisabled(capturing);
+    if (ImGui::Button(capturing ? "Capturing..." : "Capture")) {
+        StartCapture(m_IncludeHeap);
+    }
+    ImGui::EndDisabled();
+    ImGui::SameLine();
+    ImGui::BeginDisabled(baseline != nullptr);
+    ImGui::Checkbox("Include TArray/FString heap", &m_IncludeHeap);
+    ImGui::EndDisabled();
+    ImGui::SameLine();
+    ImGui::BeginDisabled(!report);
+    if (ImGui::Button("Set Baseline")) {
+        SetBaseline(report);
+        baseline = report;
+    }
+    ImGui::EndDisabled();
+    ImGui::SameLine();
+    ImGui::BeginDisabled(!baseline);
+    if (ImGui::Button("Clear Baseline")) {
+        SetBaseline(nullptr);
+        baseline = nullptr;
+    }
+    ImGui::EndDisabled();
+    ImGui::SameLine();
+    ImGui::BeginDisabled(!report);
+    if (ImGui::Button("Export CSV")) {
+        m_LastExport = ExportCSV();
+    }
+    ImGui::EndDisabled();
+
+    if (!report) {
+        ImGui::TextUnformatted("No capture yet.");
+        ImGui::End();
+        return;
+    }
+
+    ImGui::Text("%lld objects, %zu classes, %s shallow%s%s, captured in %.0f ms",
+        static_cast<long long>(report->totalCount), report->rows.size(), FormatBytes(report->totalShallowBytes).c_str(),
+        report->includesHeap ? " + " : "", report->includesHeap ? (FormatBytes(report->totalHeapBytes) + " heap").c_str() : "",
+        report->captureMs);
+
+    // A baseline of the other kind (e.g. set before StartCapture was called with another
+    // setting) is never diffed against
+    if (baseline && !SameKind(*report, *baseline)) {
+        ImGui::TextColored(ImVec4(1.0f, 0.7f, 0.3f, 1.0f), "Baseline was captured %s TArray/FString heap, this capture %s; capture again to compare.",
+            HeapSetting(*baseline), HeapSetting(*report));
+        baseline = nullptr;
+    }
+    if (baseline) {
+        ImGui::Text("Baseline: %lld objects (%+lld since)", static_cast<long long>(baseline->totalCount),
+            static_cast<long long>(report->totalCount - baseline->totalCount));
+    }
+    if (!m_LastExport.empty()) {
+        ImGui::Text("Exported to %s", m_LastExport.c_str());
+    }
+
+    ImGui::SetNextItemWidth(-FLT_MIN);
+    if (ImGui::InputTextWithHint("##MemoryFilter", "Filter classes", m_Filter, sizeof(m_Filter))) {
+        m_OrderDirty = true;
+    }
+
+    if (report != m_ShownReport || baseline != m_ShownBaseline) {
+        m_ShownReport = report;
+        m_ShownBaseline = baseline;
+        m_OrderDirty = true;
+    }
+
+    const int columns = baseline ? ColumnNum : ColumnDeltaCount;
+    ImGuiTableFlags tableFlags = ImGuiTableFlags_Sortable | ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg |
+        ImGuiTableFlags_Resizable | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV;
+    if (ImGui::BeginTable("MemoryReportTable", columns, tableFlags)) {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Class", ImGuiTableColumnFlags_WidthStretch, 0.0f, ColumnClass);
+        ImGui::TableSetupColumn("Count", ImGuiTableColumnFlags_WidthFixed, 0.0f, ColumnCount);
+        ImGui::TableSetupColumn("Shallow", ImGuiTableColumnFlags_WidthFixed, 0.0f, ColumnShallow);
+        ImGui::TableSetupColumn("Heap", ImGuiTableColumnFlags_WidthFixed, 0.0f, ColumnHeap);
+        ImGui::TableSetupColumn("Total", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultSort |
+            ImGuiTableColumnFlags_PreferSortDescending, 0.0f, ColumnTotal);
+        if (baseline) {
+            ImGui::TableSetupColumn("Count +/-", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_PreferSortDescending, 0.0f, ColumnDeltaCount);
+            ImGui::TableSetupColumn("Bytes +/-", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_PreferSortDescending, 0.0f, ColumnDeltaBytes);
+        }
+        ImGui::TableHeadersRow();
+
+        ImGuiTableSortSpecs* sortSpecs = ImGui::TableGetSortSpecs();
+        if (sortSpecs && (sortSpecs->SpecsDirty || m_OrderDirty)) {
+            int column = ColumnTotal;
+            bool ascending = false;
+            if (sortSpecs->SpecsCount > 0) {
+                column = static_cast<int>(sortSpecs->Specs[0].ColumnUserID);
+                ascending = sortSpecs->Specs[0].SortDirection == ImGuiSortDirection_Ascending;
+            }
+            SortRows(*report, baseline.get(), column, ascending);
+            sortSpecs->SpecsDirty = false;
+            m_OrderDirty = false;
+        }
+
+        // Only the visible rows are formatted
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(m_Order.size()));
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+                bool gone;
+                const ClassRow& row = DisplayRow(*report, baseline.get(), m_Vanished, m_Order[i], gone);
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(ColumnClass);
+                if (gone) {
+                    ImGui::TextDisabled("%s (gone)", row.className.c_str());
+                } else {
+                    ImGui::TextUnformatted(row.className.c_str());
+                }
+                ImGui::TableSetColumnIndex(ColumnCount);
+                ImGui::Text("%lld", static_cast<long long>(gone ? 0 : row.count));
+                ImGui::TableSetColumnIndex(ColumnShallow);
+                ImGui::TextUnformatted(FormatBytes(gone ? 0 : row.shallowBytes).c_str());
+                ImGui::TableSetColumnIndex(ColumnHeap);
+                ImGui::TextUnformatted(report->includesHeap ? FormatBytes(gone ? 0 : row.heapBytes).c_str() : "-");
+                ImGui::TableSetColumnIndex(ColumnTotal);
+                ImGui::TextUnformatted(FormatBytes(gone ? 0 : row.shallowBytes + row.heapBytes).c_str());
+                if (baseline) {
+                    ImGui::TableSetColumnIndex(ColumnDeltaCount);
+                    ImGui::Text("%+lld", static_cast<long long>(gone ? -row.count : DeltaCount(row, baseline.get())));
+                    ImGui::TableSetColumnIndex(ColumnDeltaBytes);
+                    ImGui::TextUnformatted(FormatBytes(gone ? -(row.shallowBytes + row.heapBytes) : DeltaBytes(row, baseline.get())).c_str());
+                }
+            }
+        }
+        clipper.End();
+        ImGui::EndTable();
+    }
+
+    ImGui::End();
+}
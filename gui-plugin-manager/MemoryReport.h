@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Per-class memory footprint of the live UObjects.
+// A capture walks GObjects on worker threads and aggregates, per class, the instance count and
+// the shallow size (count * UClass::Size). Optionally it also adds the heap blocks owned by the
+// TArray and FString properties of each instance (Max * element size; other containers are not
+// counted). The result renders as a sortable, clipped table and can be exported to CSV.
+//
+// Any capture can be made the baseline; the table then shows each class's change since it, so
+// classes whose counts keep growing over a long session stand out when sorted by delta.
+// Deltas are only computed against a baseline with the same includesHeap setting; while a
+// baseline is set, the window captures with its setting.
+class MemoryReport {
+public:
+    struct ClassRow {
+        std::string className;
+        int64_t count = 0;
+        int64_t shallowBytes = 0;
+        int64_t heapBytes = 0;
+    };
+
+    struct Report {
+        std::time_t capturedAt = 0;
+        double captureMs = 0.0;
+        bool includesHeap = false;
+        int64_t totalCount = 0;
+        int64_t totalShallowBytes = 0;
+        int64_t totalHeapBytes = 0;
+        std::vector<ClassRow> rows;
+        std::unordered_map<std::string, size_t> rowByClass;
+    };
+
+    static MemoryReport& Get() {
+        static MemoryReport instance;
+        return instance;
+    }
+
+    // Capture on a background thread; false if one is already running
+    bool StartCapture(bool includeHeap, int threads = 0);
+    bool IsCapturing() const { return m_Capturing.load(std::memory_order_acquire); }
+
+    std::shared_ptr<const Report> GetReport() const;
+    std::shared_ptr<const Report> GetBaseline() const;
+    void SetBaseline(std::shared_ptr<const Report> baseline);
+
+    // Current report (with deltas against the baseline, if any); empty path = timestamped
+    // file under Plugin_Manager/reports. Returns the path written, or empty on failure.
+    std::string ExportCSV(const std::string& path = "") const;
+
+    // Window contents; called from the render thread
+    void RenderWindow(bool* open);
+
+private:
+    MemoryReport() = default;
+    MemoryReport(const MemoryReport&) = delete;
+    MemoryReport& operator=(const MemoryReport&) = delete;
+
+    static std::shared_ptr<Report> Capture(bool includeHeap, int threads);
+    void SortRows(const Report& report, const Report* baseline, int column, bool ascending);
+
+    mutable std::mutex m_Mutex;
+    std::shared_ptr<const Report> m_Report;
+    std::shared_ptr<const Report> m_Baseline;
+    std::atomic<bool> m_Capturing{ false };
+
+    // Render-thread state
+    std::shared_ptr<const Report> m_ShownReport;
+    std::shared_ptr<const Report> m_ShownBaseline;
+    std::vector<size_t> m_Order;        // row indices in display order; past report rows: vanished baseline rows
+    std::vector<size_t> m_Vanished;     // baseline rows of classes missing from the shown report
+    bool m_OrderDirty = true;
+    bool m_IncludeHeap = false;
+    char m_Filter[128] = "";
+    std::string m_LastExport;
+};
@@ -0,0 +1,322 @@
+#include "stdafx.h"
+#include "ObjectBrowser.h"
+#include <algorithm>
+#include <cctype>
+#include <thread>
+#include "../plugin_manager_base/Plugin_Manager_Base_SDK/ObjectArray.h"
+#include "../plugin_manager_base/Plugin_Manager_Base_SDK/SDK/SDK.hpp"
+#include "PluginLib/NameTable.h"
+#include "PluginLib/ObjectIndex.h"
+
+namespace {
+
+// Re-index at this interval while the tab is open; queries run as soon as they change
+constexpr auto RefreshInterval = std::chrono::milliseconds(2000);
+// The worker idles once the tab hasn't been drawn for this long
+constexpr int64_t IdleAfterMs = 3000;
+constexpr int MaxPathDepth = 64;
+
+int64_t NowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::string ToLower(const char* text) {
+    std::string lower(text);
+    for (char& c : lower) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return lower;
+}
+
+// needle is already lowercase
+bool ContainsIgnoreCase(const char* haystack, const std::string& needle) {
+    if (needle.empty()) {
+        return true;
+    }
+    if (!haystack) {
+        return false;
+    }
+    const char first = needle[0];
+    for (const char* start = haystack; *start; ++start) {
+        if (std::tolower(static_cast<unsigned char>(*start)) != first) {
+            continue;
+        }
+        size_t i = 1;
+        while (i < needle.size() && start[i] && std::tolower(static_cast<unsigned char>(start[i])) == needle[i]) {
+            ++i;
+        }
+        if (i == needle.size()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+void ObjectBrowser::EnsureWorker() {
+    if (m_WorkerStarted.exchange(true)) {
+        return;
+    }
+    SubmitQuery();
+    // Detached like our other background threads; the browser is a process-lifetime singleton
+    std::thread([this]() { WorkerLoop(); }).detach();
+}
+
+void ObjectBrowser::SubmitQuery() {
+    Query query;
+    query.search = ToLower(m_SearchText);
+    query.classFilter = ToLower(m_ClassText);
+    query.outer = m_Outer;
+    query.generation = ++m_Generation;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_PendingQuery = std::move(query);
+    m_Wake.notify_one();
+}
+
+void ObjectBrowser::Navigate(int32_t outer) {
+    m_Outer = outer;
+    m_SearchText[0] = '\0';
+    m_ClassText[0] = '\0';
+    SubmitQuery();
+}
+
+void ObjectBrowser::WorkerLoop() {
+    uint64_t lastGeneration = 0;
+    while (true) {
+        Query query;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_Wake.wait_for(lock, RefreshInterval, [&]() { return m_PendingQuery.generation != lastGeneration; });
+            query = m_PendingQuery;
+        }
+
+        bool newQuery = query.generation != lastGeneration;
+        if (!newQuery && NowMs() - m_LastRenderMs.load(std::memory_order_relaxed) > IdleAfterMs) {
+            continue;
+        }
+
+        try {
+            UpdateIndex();
+            std::shared_ptr<Result> result = RunQuery(query);
+            lastGeneration = query.generation;
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Published = std::move(result);
+        } catch (const std::exception& e) {
+            GUILogger::Get().Log("[ERROR] [ObjectBrowser] Exception while indexing: %s", e.what());
+            lastGeneration = query.generation;
+        } catch (...) {
+            GUILogger::Get().Log("[ERROR] [ObjectBrowser] Exception while indexing");
+            lastGeneration = query.generation;
+        }
+    }
+}
+
+void ObjectBrowser::UpdateIndex() {
+    // Both tables only apply what changed since their last pass, so this is cheap when the
+    // background refresh already ran; it just makes the tab current when it is opened
+    PluginAPI::NameTable& names = PluginAPI::NameTable::Get();
+    names.Refresh();
+    PluginAPI::ObjectIndex::Get().Refresh();
+    names.GetObjectNames(m_NameSlots);
+
+    // m_Slots is kept across passes: every slot is rewritten below, or cleared if it held an
+    // object, so a pass doesn't reallocate and zero the whole array
+    const int32_t count = ObjectArray::Num();
+    const int32_t nameCount = static_cast<int32_t>(m_NameSlots.size());
+    m_Slots.resize(count);
+    m_ObjectCount = 0;
+
+    const int32_t chunks = ObjectArray::NumChunks();
+    for (int32_t c = 0; c < chunks; ++c) {
+        int32_t itemCount = 0;
+        const SDK::FUObjectItem* items = ObjectArray::GetChunk(c, itemCount);
+        const int32_t first = c * SDK::TUObjectArray::ElementsPerChunk;
+        const int32_t end = (std::min)(count, first + static_cast<int32_t>(SDK::TUObjectArray::ElementsPerChunk));
+        for (int32_t index = first; index < end; ++index) {
+            const int32_t i = index - first;
+            SDK::UObject* object = (items && i < itemCount) ? items[i].Object : nullptr;
+            Slot& slot = m_Slots[index];
+            if (!object) {
+                if (slot.object) {
+                    slot = Slot();
+                }
+                continue;
+            }
+
+            // A slot reused since the table's pass stays unnamed until the next one
+            slot.object = object;
+            slot.name = (index < nameCount && m_NameSlots[index].Object == object) ? m_NameSlots[index].Name : nullptr;
+            slot.classIndex = object->Class ? object->Class->Index : -1;
+            slot.outer = object->Outer ? object->Outer->Index : -1;
+            ++m_ObjectCount;
+        }
+    }
+
+    m_ChildCounts.assign(m_Slots.size(), 0);
+    for (const Slot& slot : m_Slots) {
+        if (slot.object && slot.outer >= 0 && slot.outer < static_cast<int32_t>(m_ChildCounts.size())) {
+            ++m_ChildCounts[slot.outer];
+        }
+    }
+}
+
+std::shared_ptr<ObjectBrowser::Result> ObjectBrowser::RunQuery(const Query& query) {
+    auto start = std::chrono::steady_clock::now();
+    auto result = std::make_shared<Result>();
+    result->query = query;
+    result->objectCount = m_ObjectCount;
+
+    const int32_t slotCount = static_cast<int32_t>(m_Slots.size());
+    auto classNameOf = [&](const Slot& slot) -> const char* {
+        return (slot.classIndex >= 0 && slot.classIndex < slotCount) ? m_Slots[slot.classIndex].name : nullptr;
+    };
+    auto makeRow = [&](int32_t index) {
+        const Slot& slot = m_Slots[index];
+        const char* className = classNameOf(slot);
+        return Row{ index, slot.outer, m_ChildCounts[index], slot.name, className ? className : "None", slot.object };
+    };
+
+    if (!query.classFilter.empty()) {
+        // Only the instances of classes whose name matches, straight from the class index
+        PluginAPI::ObjectIndex& index = PluginAPI::ObjectIndex::Get();
+        for (const SDK::UClass* objectClass : index.GetClasses()) {
+            const int32_t classIndex = objectClass->Index;
+            if (classIndex < 0 || classIndex >= slotCount || m_Slots[classIndex].object != objectClass ||
+                !ContainsIgnoreCase(m_Slots[classIndex].name, query.classFilter)) {
+                continue;
+            }
+            for (SDK::UObject* object : index.GetInstancesOf(objectClass, true)) {
+                const int32_t i = object->Index;
+                if (i >= 0 && i < slotCount && m_Slots[i].object == object && ContainsIgnoreCase(m_Slots[i].name, query.search)) {
+                    result->rows.push_back(makeRow(i));
+                }
+            }
+        }
+        std::sort(result->rows.begin(), result->rows.end(), [](const Row& a, const Row& b) { return a.index < b.index; });
+    } else {
+        const bool browsing = query.search.empty();
+        for (int32_t i = 0; i < slotCount; ++i) {
+            const Slot& slot = m_Slots[i];
+            if (!slot.object) {
+                continue;
+            }
+            if (browsing ? slot.outer != query.outer : !ContainsIgnoreCase(slot.name, query.search)) {
+                continue;
+            }
+            result->rows.push_back(makeRow(i));
+        }
+    }
+
+    for (int32_t o = query.outer, depth = 0; o >= 0 && o < slotCount && m_Slots[o].object && depth < MaxPathDepth; o = m_Slots[o].outer, ++depth) {
+        result->path.push_back(makeRow(o));
+    }
+    std::reverse(result->path.begin(), result->path.end());
+
+    result->searchMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+void ObjectBrowser::Render() {
+    m_LastRenderMs.store(NowMs(), std::memory_order_relaxed);
+    EnsureWorker();
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Shown = m_Published;
+    }
+
+    bool changed = false;
+    ImGui::SetNextItemWidth(250.0f);
+    changed |= ImGui::InputTextWithHint("##ObjectSearch", "Search names", m_SearchText, sizeof(m_SearchText));
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(200.0f);
+    changed |= ImGui::InputTextWithHint("##ObjectClass", "Class filter", m_ClassText, sizeof(m_ClassText));
+    if (changed) {
+        SubmitQuery();
+    }
+
+    const Result* shown = m_Shown.get();
+    const bool pathShown = shown && shown->query.outer == m_Outer;
+
+    // Outer-tree breadcrumb
+    ImGui::BeginDisabled(m_Outer < 0);
+    if (ImGui::Button("Up")) {
+        int32_t parent = (pathShown && shown->path.size() >= 2) ? shown->path[shown->path.size() - 2].index : -1;
+        Navigate(parent);
+    }
+    ImGui::EndDisabled();
+    ImGui::SameLine();
+    if (ImGui::SmallButton("Packages")) {
+        Navigate(-1);
+    }
+    if (pathShown) {
+        for (const Row& step : shown->path) {
+            ImGui::SameLine();
+            ImGui::TextUnformatted("/");
+            ImGui::SameLine();
+            ImGui::PushID(step.index);
+            if (ImGui::SmallButton(step.name ? step.name : "?")) {
+                Navigate(step.index);
+            }
+            ImGui::PopID();
+        }
+    }
+
+    if (!shown) {
+        ImGui::TextUnformatted("Indexing GObjects...");
+        return;
+    }
+    ImGui::Text("%zu of %d objects (%.1f ms)%s", shown->rows.size(), shown->objectCount, shown->searchMs,
+        shown->query.generation != m_Generation ? "  updating..." : "");
+
+    ImGuiTableFlags tableFlags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable |
+        ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV;
+    if (ImGui::BeginTable("ObjectBrowserTable", 5, tableFlags)) {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Index", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn("Class", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn("Children", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableSetupColumn("Address", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableHeadersRow();
+
+        // Only the visible rows are materialized; rows never dereference their object
+        int32_t navigateTo = -2;
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(shown->rows.size()));
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+                const Row& row = shown->rows[i];
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                ImGui::Text("%d", row.index);
+                ImGui::TableSetColumnIndex(1);
+                if (row.children > 0) {
+                    ImGui::PushID(row.index);
+                    if (ImGui::Selectable(row.name ? row.name : "?")) {
+                        navigateTo = row.index;
+                    }
+                    ImGui::PopID();
+                } else {
+                    ImGui::TextUnformatted(row.name ? row.name : "?");
+                }
+                ImGui::TableSetColumnIndex(2);
+                ImGui::TextUnformatted(row.className);
+                ImGui::TableSetColumnIndex(3);
+                if (row.children > 0) {
+                    ImGui::Text("%d", row.children);
+                }
+                ImGui::TableSetColumnIndex(4);
+                ImGui::Text("0x%llX", static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(row.object)));
+            }
+        }
+        clipper.End();
+        ImGui::EndTable();
+
+        if (navigateTo != -2) {
+            Navigate(navigateTo);
+        }
+    }
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "../plugin_manager_base/Plugin_Manager_Base_SDK/PluginAPI.h"
+
+// Built-in "Objects" tab: browse live UObjects by outer tree, or search them by name and class.
+// A worker thread keeps a per-slot view of GObjects (object, outer, class) and runs the queries.
+// Names come from the shared NameTable, which resolves each FName once for the whole process,
+// and class-filtered searches only visit instances of the matching classes via the shared
+// ObjectIndex. Each finished query is published as an immutable result set; the render thread
+// just swaps in the newest one and lets the list clipper format the visible rows, so a frame
+// never waits for indexing or search however many objects there are.
+class ObjectBrowser {
+public:
+    static ObjectBrowser& Get() {
+        static ObjectBrowser instance;
+        return instance;
+    }
+
+    // Tab contents; called from the render thread while the tab is open
+    void Render();
+
+private:
+    struct Row {
+        int32_t index;
+        int32_t outer;
+        int32_t children;
+        const char* name;           // NameTable's, valid for the whole session
+        const char* className;
+        SDK::UObject* object;
+    };
+
+    struct Query {
+        std::string search;         // lowercase name substring
+        std::string classFilter;    // lowercase class name substring
+        int32_t outer = -1;         // browse: children of this object (-1 = packages)
+        uint64_t generation = 0;
+    };
+
+    struct Result {
+        Query query;
+        std::vector<Row> rows;
+        std::vector<Row> path;      // query.outer and its outers, outermost first
+        int32_t objectCount = 0;
+        double searchMs = 0.0;
+    };
+
+    // One GObjects slot as of the last index pass (worker thread only)
+    struct Slot {
+        SDK::UObject* object = nullptr;
+        const char* name = nullptr;
+        int32_t classIndex = -1;
+        int32_t outer = -1;
+    };
+
+    ObjectBrowser() = default;
+    ObjectBrowser(const ObjectBrowser&) = delete;
+    ObjectBrowser& operator=(const ObjectBrowser&) = delete;
+
+    void EnsureWorker();
+    void WorkerLoop();
+    void UpdateIndex();
+    std::shared_ptr<Result> RunQuery(const Query& query);
+    void SubmitQuery();
+    void Navigate(int32_t outer);
+
+    // Worker state
+    std::vector<Slot> m_Slots;
+    std::vector<ObjectNameSlot> m_NameSlots;
+    std::vector<int32_t> m_ChildCounts;
+    int32_t m_ObjectCount = 0;
+
+    // Shared state
+    std::mutex m_Mutex;
+    std::condition_variable m_Wake;
+    Query m_PendingQuery;
+    std::shared_ptr<const Result> m_Published;
+    std::atomic<bool> m_WorkerStarted{ false };
+    std::atomic<int64_t> m_LastRenderMs{ 0 };
+
+    // Render-thread state
+    std::shared_ptr<const Result> m_Shown;
+    char m_SearchText[128] = "";
+    char m_ClassText[128] = "";
+    int32_t m_Outer = -1;
+    uint64_t m_Generation = 0;
+};
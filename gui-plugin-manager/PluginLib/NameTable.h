@@ -0,0 +1,103 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include "SDK.h"
+#include "../../plugin_manager_base/Plugin_Manager_Base_SDK/PluginAPI.h"
+
+namespace PluginAPI {
+
+// String -> FName / objects lookups.
+// The table itself (ObjectNameTable) lives in the Plugin Loader base DLL, once per process:
+// every distinct name in GObjects is resolved through AppendString once and interned in a
+// case-insensitive hash table, together with the live objects carrying that name. Looking an
+// object or class up by name is then one hash probe plus the objects of that name, instead of
+// a GetName() call per object in GObjects. It is refreshed incrementally by the same slot
+// fingerprint diff as ObjectIndex, on a thread the GUI starts, so plugins share it as is.
+//
+// Results are copied out of the table and re-validated against their slot; visitors run after
+// the copy, with no table lock held. The table is harvested from object names because the SDK
+// exposes no name-pool iteration; names not used by any live object (e.g. function parameter
+// names) are not in it.
+class NameTable {
+public:
+    static NameTable& Get() {
+        static NameTable instance;
+        return instance;
+    }
+
+    // Apply everything that changed in GObjects since the last refresh, now
+    void Refresh() { RefreshNameTable(); }
+
+    // Refresh on the base DLL's background thread every intervalMs (the first pass builds the table)
+    void StartAutoRefresh(uint32_t intervalMs = 2000) { StartNameTableRefresh(intervalMs); }
+
+    // Stops and joins that thread
+    void StopAutoRefresh() { StopNameTableRefresh(); }
+
+    bool IsBuilt() const { return IsNameTableBuilt(); }
+
+    size_t GetNameCount() const { return GetNameTableSize(); }
+
+    // FName for a name string (including any _N number suffix); false if no object uses it
+    bool FindName(std::string_view name, SDK::FName& outName) {
+        return FindNameInTable(name.data(), name.size(), &outName);
+    }
+
+    std::vector<SDK::UObject*> FindObjects(std::string_view name) {
+        std::vector<SDK::UObject*> result;
+        CopyOut(result, [&](SDK::UObject** buffer, size_t capacity) {
+            return FindObjectsByName(name.data(), name.size(), buffer, capacity);
+        });
+        return result;
+    }
+
+    // Every GObjects slot as of the last refresh, indexed like GObjects: its object and that
+    // object's name (nullptr for an empty slot). The names stay valid for the whole session.
+    void GetObjectNames(std::vector<ObjectNameSlot>& out) {
+        CopyOut(out, [](ObjectNameSlot* buffer, size_t capacity) {
+            return GetObjectNameSlots(buffer, capacity);
+        });
+    }
+
+    // visit(UObject*) for each live object named name; returns false to stop early
+    template <typename Visitor>
+    void ForEachObjectNamed(std::string_view name, Visitor&& visit) {
+        for (SDK::UObject* object : FindObjects(name)) {
+            if (!visit(object)) {
+                return;
+            }
+        }
+    }
+
+    // First live object named name, or nullptr
+    SDK::UObject* FindObject(std::string_view name) {
+        SDK::UObject* found = nullptr;
+        ForEachObjectNamed(name, [&](SDK::UObject* object) {
+            found = object;
+            return false;
+        });
+        return found;
+    }
+
+    // Class named name (e.g. "PlayerController"), or nullptr
+    SDK::UClass* FindClass(std::string_view name) {
+        SDK::UObject* found = nullptr;
+        const SDK::UClass* classClass = SDK::UClass::StaticClass();
+        ForEachObjectNamed(name, [&](SDK::UObject* object) {
+            if (object->IsA(classClass)) {
+                found = object;
+                return false;
+            }
+            return true;
+        });
+        return static_cast<SDK::UClass*>(found);
+    }
+
+private:
+    NameTable() = default;
+    NameTable(const NameTable&) = delete;
+    NameTable& operator=(const NameTable&) = delete;
+};
+
+}  // namespace PluginAPI
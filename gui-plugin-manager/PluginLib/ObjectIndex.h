@@ -0,0 +1,97 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "SDK.h"
+#include "../../plugin_manager_base/Plugin_Manager_Base_SDK/PluginAPI.h"
+
+namespace PluginAPI {
+
+// Class -> live instances lookups over GObjects.
+// The index itself (ClassInstanceIndex) lives in the Plugin Loader base DLL, once per process,
+// and is kept current by a low-frequency diff of every slot's fingerprint: only slots that
+// changed touch the index, and nothing calls IsA. "All instances of X" is then proportional to
+// the number of instances, not to the size of GObjects. The GUI starts its refresh thread, so
+// plugins see the same up-to-date index without refreshing anything themselves.
+//
+// Results are copied out of the index and re-validated against their slot, so an object
+// destroyed since the last refresh is never handed out; one created since then shows up after
+// the next. Visitors and predicates run after the copy, with no index lock held, and may query
+// the index again.
+class ObjectIndex {
+public:
+    static ObjectIndex& Get() {
+        static ObjectIndex instance;
+        return instance;
+    }
+
+    // Apply everything that changed in GObjects since the last refresh, now
+    void Refresh() { RefreshObjectIndex(); }
+
+    // Refresh on the base DLL's background thread every intervalMs (builds first if needed)
+    void StartAutoRefresh(uint32_t intervalMs = 2000) { StartObjectIndexRefresh(intervalMs); }
+
+    // Stops and joins that thread
+    void StopAutoRefresh() { StopObjectIndexRefresh(); }
+
+    bool IsBuilt() const { return IsObjectIndexBuilt(); }
+
+    // Live instances of objectClass (and its subclasses unless exactClassOnly)
+    std::vector<SDK::UObject*> GetInstancesOf(const SDK::UClass* objectClass, bool exactClassOnly = false) {
+        std::vector<SDK::UObject*> result;
+        if (objectClass) {
+            CopyOut(result, [&](SDK::UObject** buffer, size_t capacity) {
+                return GetClassInstances(objectClass, exactClassOnly, buffer, capacity);
+            });
+        }
+        return result;
+    }
+
+    template <typename T>
+    std::vector<T*> GetInstances(bool exactClassOnly = false) {
+        std::vector<T*> result;
+        for (SDK::UObject* object : GetInstancesOf(T::StaticClass(), exactClassOnly)) {
+            result.push_back(static_cast<T*>(object));
+        }
+        return result;
+    }
+
+    // Every class with at least one live instance in the index
+    std::vector<const SDK::UClass*> GetClasses() {
+        std::vector<const SDK::UClass*> result;
+        CopyOut(result, [](const SDK::UClass** buffer, size_t capacity) {
+            return GetIndexedClasses(buffer, capacity);
+        });
+        return result;
+    }
+
+    // First live instance for which predicate returns true, or nullptr
+    template <typename Predicate>
+    SDK::UObject* FindFirst(const SDK::UClass* objectClass, Predicate&& predicate) {
+        SDK::UObject* found = nullptr;
+        ForEachInstance(objectClass, false, [&](SDK::UObject* object) {
+            if (predicate(object)) {
+                found = object;
+                return false;
+            }
+            return true;
+        });
+        return found;
+    }
+
+    // visit(UObject*) returns false to stop early
+    template <typename Visitor>
+    void ForEachInstance(const SDK::UClass* objectClass, bool exactClassOnly, Visitor&& visit) {
+        for (SDK::UObject* object : GetInstancesOf(objectClass, exactClassOnly)) {
+            if (!visit(object)) {
+                return;
+            }
+        }
+    }
+
+private:
+    ObjectIndex() = default;
+    ObjectIndex(const ObjectIndex&) = delete;
+    ObjectIndex& operator=(const ObjectIndex&) = delete;
+};
+
+}  // namespace PluginAPI
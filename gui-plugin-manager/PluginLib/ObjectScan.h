@@ -0,0 +1,237 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <emmintrin.h>
+#include "SDK.h"
+#include "../../plugin_manager_base/Plugin_Manager_Base_SDK/ObjectArray.h"
+
+namespace PluginAPI {
+
+// What an ObjectScan matches. Every set criterion must hold.
+struct ScanFilter {
+    uint32_t requiredFlags = 0;                 // EObjectFlags that must all be set
+    uint32_t excludedFlags = 0;                 // EObjectFlags that must all be clear
+    std::vector<const SDK::UClass*> classes;    // object class is one of these (empty = any)
+    bool includeSubclasses = true;              // ... or derives from one of them
+    const SDK::UObject* outer = nullptr;        // direct Outer (nullptr = any)
+};
+
+// Filtered pass over all of GObjects, for queries ObjectIndex doesn't answer (flags, outer,
+// several classes at once) without a GetByIndex + IsA loop per plugin.
+// The scan walks each chunk's item span directly, prefetches objects ahead, gathers the flags,
+// class and outer of eight objects at a time and tests them with SSE2 compares. Exact class sets
+// of up to four classes are compared in registers too; larger sets and subclass tests go through
+// a per-scan verdict cache, so IsSubclassOf runs once per distinct class, not once per object.
+//
+// A scan is reusable: keep it around and call Run() again, and the result and per-worker buffers
+// keep their capacity. Like any GObjects walk, objects may be created or destroyed meanwhile.
+class ObjectScan {
+public:
+    explicit ObjectScan(ScanFilter filter = {}) {
+        SetFilter(std::move(filter));
+    }
+
+    void SetFilter(ScanFilter filter) {
+        m_Filter = std::move(filter);
+        m_Filter.classes.erase(std::remove(m_Filter.classes.begin(), m_Filter.classes.end(), nullptr), m_Filter.classes.end());
+        m_ClassesInRegisters = !m_Filter.classes.empty() && !m_Filter.includeSubclasses &&
+            m_Filter.classes.size() <= MaxRegisterClasses;
+    }
+
+    const ScanFilter& GetFilter() const { return m_Filter; }
+
+    // Matching objects in GObjects order; the returned buffer is reused by the next Run().
+    // threads > 1 splits the chunks across workers (0 = half the hardware threads); small
+    // arrays are always scanned on the calling thread.
+    const std::vector<SDK::UObject*>& Run(int threads = 1) {
+        m_Results.clear();
+        const int32_t chunks = ObjectArray::NumChunks();
+        if (threads <= 0) {
+            threads = (std::max)(1, static_cast<int>(std::thread::hardware_concurrency()) / 2);
+        }
+        threads = (std::min)(threads, chunks / MinChunksPerWorker);
+
+        if (threads <= 1) {
+            Worker& worker = WorkerAt(0);
+            for (int32_t c = 0; c < chunks; ++c) {
+                ScanChunk(c, worker, m_Results);
+            }
+            return m_Results;
+        }
+
+        // Contiguous chunk ranges so concatenating the workers keeps GObjects order
+        std::vector<std::thread> workers;
+        const int32_t step = (chunks + threads - 1) / threads;
+        for (int t = 0; t < threads; ++t) {
+            WorkerAt(t).results.clear();
+        }
+        for (int t = 0; t < threads; ++t) {
+            int32_t begin = t * step;
+            int32_t end = (std::min)(chunks, begin + step);
+            workers.emplace_back([this, t, begin, end]() {
+                Worker& worker = m_Workers[t];
+                for (int32_t c = begin; c < end; ++c) {
+                    ScanChunk(c, worker, worker.results);
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        for (int t = 0; t < threads; ++t) {
+            m_Results.insert(m_Results.end(), m_Workers[t].results.begin(), m_Workers[t].results.end());
+        }
+        return m_Results;
+    }
+
+    // One-shot form
+    static std::vector<SDK::UObject*> Find(ScanFilter filter, int threads = 1) {
+        ObjectScan scan(std::move(filter));
+        return scan.Run(threads);
+    }
+
+private:
+    static constexpr size_t MaxRegisterClasses = 4;
+    static constexpr int32_t BlockSize = 8;
+    static constexpr int32_t PrefetchDistance = 32;     // items ahead whose object is prefetched
+    static constexpr int32_t MinChunksPerWorker = 2;
+
+    struct Worker {
+        std::unordered_map<const SDK::UClass*, bool> classVerdicts;  // rebuilt per Run
+        std::vector<SDK::UObject*> results;
+    };
+
+    Worker& WorkerAt(int index) {
+        if (static_cast<int>(m_Workers.size()) <= index) {
+            m_Workers.resize(index + 1);
+        }
+        // Classes can be unloaded between runs and their addresses reused
+        m_Workers[index].classVerdicts.clear();
+        return m_Workers[index];
+    }
+
+    // Two 64-bit lanes equal -> both 32-bit halves equal (SSE2 has no 64-bit compare)
+    static __m128i Equal64(__m128i a, __m128i b) {
+        __m128i eq32 = _mm_cmpeq_epi32(a, b);
+        return _mm_and_si128(eq32, _mm_shuffle_epi32(eq32, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+
+    // Bit i set if pointers[i] equals one of keys (lanes of two 64-bit compares)
+    static uint32_t PointerMask(const uintptr_t* pointers, const __m128i* keys, size_t keyCount) {
+        uint32_t mask = 0;
+        for (int32_t pair = 0; pair < BlockSize / 2; ++pair) {
+            __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pointers + pair * 2));
+            __m128i hits = Equal64(values, keys[0]);
+            for (size_t k = 1; k < keyCount; ++k) {
+                hits = _mm_or_si128(hits, Equal64(values, keys[k]));
+            }
+            mask |= static_cast<uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(hits))) << (pair * 2);
+        }
+        return mask;
+    }
+
+    bool ClassMatches(const SDK::UClass* objectClass, Worker& worker) const {
+        if (!objectClass) {
+            return false;
+        }
+        auto [it, inserted] = worker.classVerdicts.try_emplace(objectClass, false);
+        if (inserted) {
+            for (const SDK::UClass* cls : m_Filter.classes) {
+                if (objectClass == cls || (m_Filter.includeSubclasses && objectClass->IsSubclassOf(cls))) {
+                    it->second = true;
+                    break;
+                }
+            }
+        }
+        return it->second;
+    }
+
+    void ScanChunk(int32_t chunkIndex, Worker& worker, std::vector<SDK::UObject*>& out) const {
+        int32_t count = 0;
+        const SDK::FUObjectItem* items = ObjectArray::GetChunk(chunkIndex, count);
+        if (!items) {
+            return;
+        }
+
+        const __m128i required = _mm_set1_epi32(static_cast<int>(m_Filter.requiredFlags));
+        const __m128i excluded = _mm_set1_epi32(static_cast<int>(m_Filter.excludedFlags));
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i outer = _mm_set1_epi64x(static_cast<long long>(reinterpret_cast<uintptr_t>(m_Filter.outer)));
+        __m128i classKeys[MaxRegisterClasses];
+        for (size_t k = 0; m_ClassesInRegisters && k < m_Filter.classes.size(); ++k) {
+            classKeys[k] = _mm_set1_epi64x(static_cast<long long>(reinterpret_cast<uintptr_t>(m_Filter.classes[k])));
+        }
+        const bool testClasses = !m_Filter.classes.empty();
+
+        alignas(16) SDK::UObject* objects[BlockSize];
+        alignas(16) uint32_t flags[BlockSize];
+        alignas(16) uintptr_t classes[BlockSize];
+        alignas(16) uintptr_t outers[BlockSize];
+
+        for (int32_t base = 0; base < count; base += BlockSize) {
+            const int32_t blockCount = (std::min)(BlockSize, count - base);
+
+            // Gather; empty slots get flags that fail any test and are masked out below
+            uint32_t present = 0;
+            for (int32_t i = 0; i < BlockSize; ++i) {
+                SDK::UObject* object = i < blockCount ? items[base + i].Object : nullptr;
+                int32_t ahead = base + i + PrefetchDistance;
+                if (ahead < count && items[ahead].Object) {
+                    _mm_prefetch(reinterpret_cast<const char*>(items[ahead].Object), _MM_HINT_T0);
+                }
+                objects[i] = object;
+                if (object) {
+                    present |= 1u << i;
+                    flags[i] = static_cast<uint32_t>(object->Flags);
+                    classes[i] = reinterpret_cast<uintptr_t>(object->Class);
+                    outers[i] = reinterpret_cast<uintptr_t>(object->Outer);
+                } else {
+                    flags[i] = 0;
+                    classes[i] = 0;
+                    outers[i] = 0;
+                }
+            }
+            if (!present) {
+                continue;
+            }
+
+            // (flags & required) == required && (flags & excluded) == 0, four lanes per compare
+            uint32_t mask = present;
+            for (int32_t quad = 0; quad < BlockSize / 4; ++quad) {
+                __m128i values = _mm_load_si128(reinterpret_cast<const __m128i*>(flags + quad * 4));
+                __m128i ok = _mm_and_si128(
+                    _mm_cmpeq_epi32(_mm_and_si128(values, required), required),
+                    _mm_cmpeq_epi32(_mm_and_si128(values, excluded), zero));
+                uint32_t quadMask = static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(ok)));
+                mask &= ~(0xFu << (quad * 4)) | (quadMask << (quad * 4));
+            }
+            if (mask && m_Filter.outer) {
+                mask &= PointerMask(outers, &outer, 1);
+            }
+            if (mask && m_ClassesInRegisters) {
+                mask &= PointerMask(classes, classKeys, m_Filter.classes.size());
+            }
+
+            for (int32_t bit = 0; mask && bit < BlockSize; ++bit) {
+                if (!(mask & (1u << bit))) {
+                    continue;
+                }
+                if (testClasses && !m_ClassesInRegisters &&
+                    !ClassMatches(reinterpret_cast<const SDK::UClass*>(classes[bit]), worker)) {
+                    continue;
+                }
+                out.push_back(objects[bit]);
+            }
+        }
+    }
+
+    ScanFilter m_Filter;
+    bool m_ClassesInRegisters = false;
+    std::vector<Worker> m_Workers;
+    std::vector<SDK::UObject*> m_Results;
+};
+
+}  // namespace PluginAPI
@@ -1,4 +1,7 @@
 #pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
 #include <functional>
 #include <string>
 #include <vector>
@@ -10,7 +13,25 @@ struct ImGuiContext;
 namespace PluginAPI {
 
     // Version for API compatibility checking
-    constexpr int API_VERSION = 1;
+    constexpr int API_VERSION = 2;
+
+    // Log levels for channels; a channel's levelMask has bit (1 << level) set for every enabled level
+    enum LogLevel : uint32_t {
+        LOG_LEVEL_ERROR = 0,
+        LOG_LEVEL_WARNING = 1,
+        LOG_LEVEL_INFO = 2,
+        LOG_LEVEL_DEBUG = 3,
+        LOG_LEVEL_TRACE = 4,
+        LOG_LEVEL_COUNT
+    };
+
+    // Named log channel owned by the Plugin Loader. The pointer returned by RegisterLogChannel
+    // stays valid for the whole session; levelMask changes live when the user adjusts the
+    // channel's verbosity in the GUI, so read it at every call site (PLUGIN_LOGF does).
+    struct LogChannel {
+        char name[64];
+        std::atomic<uint32_t> levelMask;
+    };
 
     // Plugin interface that all plugins must implement
     class IPlugin {
@@ -75,16 +96,72 @@ namespace PluginAPI {
 
         // Version
         int apiVersion;
+
+        // Log channels (apiVersion >= 2). Registering the same name twice returns the same channel.
+        LogChannel* (*RegisterLogChannel)(const char* name);
+        void (*LogToChannel)(LogChannel* channel, LogLevel level, const char* message);
     };
 
     // Export function that plugins must implement
     // extern "C" __declspec(dllexport) IPlugin* CreatePlugin(const MasterAPI* api);
+
+    // When a plugin is loaded (PluginManifest::triggers); any combination
+    enum ActivationTrigger : uint32_t {
+        ACTIVATE_ON_STARTUP = 1u << 0,      // load at startup (also the default without a manifest)
+        ACTIVATE_ON_TAB_OPEN = 1u << 1,     // load when its placeholder tab is first opened
+        ACTIVATE_ON_HOTKEY = 1u << 2,       // load when activationHotkey is first pressed
+        ACTIVATE_ON_HOOK = 1u << 3,         // load when hookClass::hookFunction is first called;
+                                            // that call is over before the plugin loads, so it isn't delivered
+    };
+
+    // Optional exported manifest. The loader reads it from the DLL file without running plugin
+    // code, so it must be constant data: fixed-size strings, no pointers. Until a trigger fires
+    // the plugin is not loaded and its tab is a placeholder built from these fields.
+    struct PluginManifest {
+        uint32_t size;                      // sizeof(PluginManifest)
+        uint32_t triggers;                  // ActivationTrigger flags
+        char name[64];
+        char version[32];
+        char author[64];
+        char description[256];
+        char tabName[64];
+        int activationHotkey;               // virtual-key code, for ACTIVATE_ON_HOTKEY
+        char hookClass[128];                // for ACTIVATE_ON_HOOK
+        char hookFunction[128];
+    };
 }
 
 // Macro to simplify plugin creation
 #define PLUGIN_EXPORT extern "C" __declspec(dllexport)
 
+// Exports the plugin API version the plugin was built against. The loader reads it from the
+// DLL file (no plugin code runs) and skips plugins built for a newer API than it provides.
+// Usage: PLUGIN_DECLARE_API_VERSION(); next to CreatePlugin
+#define PLUGIN_DECLARE_API_VERSION() \
+    PLUGIN_EXPORT const int PluginApiVersion = PluginAPI::API_VERSION
+
+// Declares the plugin's manifest (see PluginAPI::PluginManifest). Usage:
+// PLUGIN_DECLARE_MANIFEST(PluginAPI::ACTIVATE_ON_TAB_OPEN, "My Plugin", "1.0", "Me", "What it does", "My Tab", 0, "", "");
+#define PLUGIN_DECLARE_MANIFEST(triggers, name, version, author, description, tabName, hotkey, hookClass, hookFunction) \
+    PLUGIN_EXPORT const PluginAPI::PluginManifest PluginManifest = { \
+        sizeof(PluginAPI::PluginManifest), (triggers), name, version, author, description, tabName, (hotkey), hookClass, hookFunction }
+
 // Helper macro for logging
 #define PLUGIN_LOG(api, msg) (api)->LogInfo(msg)
 #define PLUGIN_LOG_ERROR(api, msg) (api)->LogError(msg)
 #define PLUGIN_LOG_WARNING(api, msg) (api)->LogWarning(msg)
+
+// Channel logging: the level check is one relaxed atomic load, and the format arguments are
+// only evaluated when the level is enabled, so muted channels cost nothing more than that.
+// Usage: PLUGIN_LOGF(api, channel, PluginAPI::LOG_LEVEL_DEBUG, "Spawned %d actors", count);
+#define PLUGIN_LOG_ENABLED(channel, level) \
+    ((channel) && ((channel)->levelMask.load(std::memory_order_relaxed) & (1u << (level))))
+
+#define PLUGIN_LOGF(api, channel, level, ...) \
+    do { \
+        if (PLUGIN_LOG_ENABLED(channel, level)) { \
+            char pluginLogBuffer_[1024]; \
+            snprintf(pluginLogBuffer_, sizeof(pluginLogBuffer_), __VA_ARGS__); \
+            (api)->LogToChannel((channel), (level), pluginLogBuffer_); \
+        } \
+    } while (0)
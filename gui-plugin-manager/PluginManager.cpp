@@ -1,5 +1,6 @@
 #include "PluginManager.h"
 #include <filesystem>
+#include <algorithm>
 #include <iostream>
 #include <cstdio>
 #include <stdarg.h>
@@ -8,6 +9,13 @@
 #include "../plugin_manager_base/Plugin_Manager_Base_SDK/SimpleHookManager.h"
 #include "../plugin_manager_base/Plugin_Manager_Base_SDK/SDK/SDK.hpp"
 #include "GUILogger.h"
+#include "PluginLib/ObjectIndex.h"
+#include "PluginLib/NameTable.h"
+#include "WorldContext.h"
+#include "ObjectBrowser.h"
+#include "PluginManifestCache.h"
+#include "PluginLib/HotkeyManager.h"
+#include "../plugin_manager_base/Plugin_Manager_Base_SDK/PluginAPI.h"
 
 namespace fs = std::filesystem;
 
@@ -41,6 +49,20 @@ static void StaticLogError(const char* message) {
     GUILogger::Get().Log("[ERROR] %s", message);
 }
 
+static const char* const s_LogLevelNames[PluginAPI::LOG_LEVEL_COUNT] = { "ERROR", "WARNING", "INFO", "DEBUG", "TRACE" };
+
+static PluginAPI::LogChannel* StaticRegisterLogChannel(const char* name) {
+    return PluginManager::Get().RegisterLogChannel(name);
+}
+
+static void StaticLogToChannel(PluginAPI::LogChannel* channel, PluginAPI::LogLevel level, const char* message) {
+    // PLUGIN_LOGF already checked, but plugins may call this directly
+    if (!channel || level >= PluginAPI::LOG_LEVEL_COUNT || !PLUGIN_LOG_ENABLED(channel, level)) {
+        return;
+    }
+    GUILogger::Get().Log("[%s] [%s] %s", s_LogLevelNames[level], channel->name, message);
+}
+
 static ImGuiContext* StaticGetImGuiContext() {
     return g_PluginManagerInstance ? g_PluginManagerInstance->m_ImGuiContext : nullptr;
 }
@@ -55,59 +77,11 @@ static void StaticReloadPlugins() {
     }
 }
 
-static SDK::APlayerController* GetPlayerController() {
-    SDK::UWorld* World = SDK::UWorld::GetWorld();
-    StaticLogInfo("[SDK] GetPlayerController: Attempting to get world...");
-    if (!World) {
-        StaticLogError("[SDK] GetPlayerController: World is nullptr");
-        return nullptr;
-    }
-    StaticLogInfo("[SDK] GetPlayerController: World found");
-
-    if (!World->OwningGameInstance) {
-        StaticLogError("[SDK] GetPlayerController: OwningGameInstance is nullptr");
-        return nullptr;
-    }
-    StaticLogInfo("[SDK] GetPlayerController: OwningGameInstance found");
-
-    if (World->OwningGameInstance->LocalPlayers.Num() <= 0) {
-        StaticLogError("[SDK] GetPlayerController: No LocalPlayers");
-        return nullptr;
-    }
-    StaticLogInfo("[SDK] GetPlayerController: LocalPlayers found");
-
-    if (!World->OwningGameInstance->LocalPlayers[0]) {
-        StaticLogError("[SDK] GetPlayerController: LocalPlayers[0] is nullptr");
-        return nullptr;
-    }
-    StaticLogInfo("[SDK] GetPlayerController: LocalPlayers[0] found");
-
-    SDK::APlayerController* PC = World->OwningGameInstance->LocalPlayers[0]->PlayerController;
-    if (PC) {
-        StaticLogInfo("[SDK] GetPlayerController: PlayerController found successfully");
-        return PC;
-    }
-    StaticLogError("[SDK] GetPlayerController: PlayerController is nullptr");
-    return nullptr;
-}
-
-static SDK::APlayerController* FindPlayerControllerViaGObjects() {
-    for (int i = 0; i < SDK::UObject::GObjects->Num(); i++) {
-        SDK::UObject* Obj = SDK::UObject::GObjects->GetByIndex(i);
-        if (Obj && Obj->IsA(SDK::APlayerController::StaticClass())) {
-            SDK::APlayerController* PC = static_cast<SDK::APlayerController*>(Obj);
-            if (PC->PlayerCameraManager) return PC;
-        }
-    }
-    return nullptr;
-}
-
 static void StaticTogglePhotoMode() {
     try {
         StaticLogInfo("[SDK] Photo Mode toggle requested - executing...");
 
-        SDK::APlayerController* PC = GetPlayerController();
-        if (!PC) PC = FindPlayerControllerViaGObjects();
+        SDK::APlayerController* PC = WorldContext::Get().GetPlayerController();
         if (!PC) {
             StaticLogError("[SDK] ERROR: PlayerController not found");
             return;
@@ -137,24 +111,18 @@ static void StaticToggleHUD() {
     try {
         StaticLogInfo("[SDK] HUD toggle requested - executing...");
 
-        SDK::APlayerController* PC = GetPlayerController();
-        if (!PC) {
-            StaticLogInfo("[SDK] Primary GetPlayerController failed, trying GObjects...");
-            PC = FindPlayerControllerViaGObjects();
-        }
-        if (!PC) {
-            StaticLogError("[SDK] ERROR: PlayerController not found via both methods");
+        if (!WorldContext::Get().GetPlayerController()) {
+            StaticLogError("[SDK] ERROR: PlayerController not found");
             return;
         }
 
-        StaticLogInfo("[SDK] Got PlayerController, attempting GetHUD()...");
-        SDK::AHUD* HUD = PC->GetHUD();
+        SDK::AHUD* HUD = WorldContext::Get().GetHUD();
         if (HUD) {
             StaticLogInfo("[SDK] HUD found, calling ShowHUD()...");
             HUD->ShowHUD();
             StaticLogInfo("[SDK] HUD toggled successfully");
         } else {
-            StaticLogError("[SDK] ERROR: HUD not found (GetHUD returned nullptr)");
+            StaticLogError("[SDK] ERROR: HUD not found");
         }
     } catch (...) {
         StaticLogError("[SDK] Exception in ToggleHUD");
@@ -177,14 +145,12 @@ static void StaticTeleportToLocation(float x, float y, float z) {
         snprintf(buffer, sizeof(buffer), "[SDK] Attempting teleport to (%.1f, %.1f, %.1f)", x, y, z);
         StaticLogInfo(buffer);
 
-        SDK::APlayerController* PC = GetPlayerController();
-        if (!PC) PC = FindPlayerControllerViaGObjects();
-        if (!PC) {
+        if (!WorldContext::Get().GetPlayerController()) {
             StaticLogError("[SDK] ERROR: PlayerController not found");
             return;
         }
 
-        SDK::APawn* Pawn = PC->AcknowledgedPawn;
+        SDK::APawn* Pawn = WorldContext::Get().GetPawn();
         if (Pawn) {
             SDK::FVector Location;
             Location.X = x;
@@ -218,6 +184,8 @@ void PluginManager::SetupMasterAPI() {
     m_MasterAPI.ExecuteOnGameThread = StaticExecuteOnGameThread;
     m_MasterAPI.ReloadPlugins = StaticReloadPlugins;
     m_MasterAPI.IsMenuOpen = StaticIsMenuOpen;
+    m_MasterAPI.RegisterLogChannel = StaticRegisterLogChannel;
+    m_MasterAPI.LogToChannel = StaticLogToChannel;
 
     g_PluginManagerInstance = this;
 }
@@ -226,6 +194,12 @@ void PluginManager::Initialize(ImGuiContext* imguiCtx) {
     m_ImGuiContext = imguiCtx;
     SetupMasterAPI();
 
+    // Class -> instances index for GObjects lookups, shared with every plugin; built and kept
+    // current by a refresh thread in the base DLL
+    PluginAPI::ObjectIndex::Get().StartAutoRefresh();
+    // Name -> FName / objects table for by-name lookups; same thread model
+    PluginAPI::NameTable::Get().StartAutoRefresh();
+
     printf("[PluginManager] Initializing...\n");
     fflush(stdout);
 
@@ -248,9 +222,9 @@ void PluginManager::Initialize(ImGuiContext* imguiCtx) {
         }
     }
 
+    // Lets known-bad DLLs be skipped without loading them; see PluginManifestCache
+    PluginManifestCache::Get().Load(dllDir + "settings\\plugin_cache.ini");
     LoadPluginsFromDirectory(pluginsDir.c_str());
-    printf("[PluginManager] Loaded %zu plugin(s)\n", m_Plugins.size());
-    fflush(stdout);
 }
 
 void PluginManager::Shutdown() {
@@ -266,6 +240,25 @@ void PluginManager::Shutdown() {
         }
     }
 
+    // Plugins still queued are never initialized; loader threads skip the ones they haven't mapped
+    // yet, and mapped ones stay loaded like every other DLL here
+    for (size_t i = m_NextPendingPlugin; i < m_PendingPlugins.size(); ++i) {
+        PendingPlugin& pending = *m_PendingPlugins[i];
+        pending.abandoned.store(true, std::memory_order_release);
+        printf("[PluginManager] Not initialized (shutting down): %s\n", pending.dllPath.c_str());
+    }
+    m_PendingPlugins.clear();
+    m_NextPendingPlugin = 0;
+
+    // Deferred plugins never activate now; their activation hooks would outlive the manager
+    for (DeferredPlugin& deferred : m_DeferredPlugins) {
+        if (deferred.hookHandle) {
+            UnregisterGlobalHook(deferred.hookHandle);
+            deferred.hookHandle = 0;
+        }
+    }
+    m_DeferredPlugins.clear();
+
     printf("[PluginManager] Cleaning up hook systems...\n");
     fflush(stdout);
 
@@ -279,6 +272,35 @@ void PluginManager::Shutdown() {
     fflush(stdout);
 }
 
+namespace {
+
+// Frame budget for CreatePlugin/OnLoad; at least one plugin is initialized per frame regardless
+constexpr double PluginInitBudgetMs = 8.0;
+constexpr unsigned MaxLoaderThreads = 4;
+
+double MillisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::string DescribeTriggers(const PluginManifestCache::Manifest& manifest) {
+    std::string text;
+    auto add = [&](const std::string& part) {
+        text += text.empty() ? part : " or " + part;
+    };
+    if (manifest.triggers & PluginAPI::ACTIVATE_ON_TAB_OPEN) {
+        add("its tab is opened");
+    }
+    if (manifest.triggers & PluginAPI::ACTIVATE_ON_HOTKEY) {
+        add(std::string(HotkeyManager::GetHotkeyString(manifest.activationHotkey, false, false, false)) + " is pressed");
+    }
+    if (manifest.triggers & PluginAPI::ACTIVATE_ON_HOOK) {
+        add(manifest.hookClass + "::" + manifest.hookFunction + " is called");
+    }
+    return text.empty() ? "loaded manually" : text;
+}
+
+}  // namespace
+
 void PluginManager::LoadPluginsFromDirectory(const char* directory) {
     printf("[PluginManager] Scanning directory: %s\n", directory);
     fflush(stdout);
@@ -289,53 +311,263 @@ void PluginManager::LoadPluginsFromDirectory(const char* directory) {
         return;
     }
 
+    std::vector<std::string> dllPaths;
     try {
         for (const auto& entry : fs::directory_iterator(directory)) {
             if (entry.is_regular_file() && entry.path().extension() == ".dll") {
-                std::string dllPath = entry.path().string();
-                printf("[PluginManager] Found plugin: %s\n", dllPath.c_str());
-                fflush(stdout);
-                LoadPlugin(dllPath.c_str());
+                dllPaths.push_back(entry.path().string());
             }
         }
     } catch (const std::exception& e) {
         printf("[PluginManager] Error scanning directory: %s\n", e.what());
         fflush(stdout);
     }
+    PluginManifestCache::Get().Retain(dllPaths);
+    if (dllPaths.empty()) {
+        PluginManifestCache::Get().Save();
+        return;
+    }
+
+    // Initialization order is the path order, whichever DLL finishes mapping first
+    std::sort(dllPaths.begin(), dllPaths.end());
+    auto queue = std::make_shared<std::vector<std::shared_ptr<PendingPlugin>>>();
+    for (const std::string& dllPath : dllPaths) {
+        printf("[PluginManager] Found plugin: %s\n", dllPath.c_str());
+        auto pending = std::make_shared<PendingPlugin>();
+        pending->dllPath = dllPath;
+        queue->push_back(pending);
+    }
+    fflush(stdout);
+    StartLoaderThreads(queue);
+}
+
+void PluginManager::StartLoaderThreads(std::shared_ptr<std::vector<std::shared_ptr<PendingPlugin>>> queue) {
+    if (!IsLoadingPlugins()) {
+        m_PluginLoadStart = std::chrono::steady_clock::now();
+        m_PluginsBeforeLoad = m_Plugins.size();
+    }
+    m_PendingPlugins.insert(m_PendingPlugins.end(), queue->begin(), queue->end());
+
+    // Validation (from the manifest cache or the file's export table), mapping, relocation and
+    // the DLLs' own static init run on loader threads
+    auto next = std::make_shared<std::atomic<size_t>>(0);
+    unsigned threadCount = (std::min)(static_cast<unsigned>(queue->size()), MaxLoaderThreads);
+    for (unsigned t = 0; t < threadCount; ++t) {
+        std::thread([queue, next]() {
+            for (size_t i = next->fetch_add(1); i < queue->size(); i = next->fetch_add(1)) {
+                PendingPlugin& pending = *(*queue)[i];
+                auto start = std::chrono::steady_clock::now();
+                if (pending.abandoned.load(std::memory_order_acquire)) {
+                    pending.mapped.store(true, std::memory_order_release);
+                    continue;
+                }
+                pending.manifest = PluginManifestCache::Get().Validate(pending.dllPath);
+                if (pending.manifest.status != PluginManifestCache::Status::Valid) {
+                    pending.skipReason = pending.manifest.reason;
+                } else if (!pending.activation && !pending.manifest.ActivatesOnStartup()) {
+                    pending.deferred = true;  // not mapped until one of its triggers fires
+                } else {
+                    pending.moduleHandle = LoadLibraryExA(pending.dllPath.c_str(), nullptr, 0);
+                    pending.error = pending.moduleHandle ? 0 : GetLastError();
+                }
+                pending.mapMs = MillisecondsSince(start);
+                pending.mapped.store(true, std::memory_order_release);
+            }
+        }).detach();
+    }
+}
+
+void PluginManager::ProcessPendingPlugins() {
+    if (!IsLoadingPlugins()) {
+        return;
+    }
+
+    auto frameStart = std::chrono::steady_clock::now();
+    do {
+        PendingPlugin& pending = *m_PendingPlugins[m_NextPendingPlugin];
+        if (!pending.mapped.load(std::memory_order_acquire)) {
+            break;  // keep the order; the rest waits for this one
+        }
+        ++m_NextPendingPlugin;
+
+        // An activated plugin leaves the deferred list whether or not it loads, so a failing
+        // trigger doesn't retry every frame
+        if (pending.activation) {
+            m_DeferredPlugins.erase(std::remove_if(m_DeferredPlugins.begin(), m_DeferredPlugins.end(),
+                [&](const DeferredPlugin& deferred) { return deferred.dllPath == pending.dllPath; }), m_DeferredPlugins.end());
+        }
+
+        if (!pending.skipReason.empty()) {
+            printf("[PluginManager] Skipping %s: %s\n", pending.dllPath.c_str(), pending.skipReason.c_str());
+            fflush(stdout);
+            GUILogger::Get().Log("[WARNING] [PluginManager] Skipped %s: %s", pending.dllPath.c_str(), pending.skipReason.c_str());
+            continue;
+        }
+        if (pending.deferred) {
+            DeferredPlugin deferred;
+            deferred.dllPath = pending.dllPath;
+            deferred.manifest = pending.manifest;
+            if (deferred.manifest.name.empty()) {
+                deferred.manifest.name = fs::path(pending.dllPath).stem().string();
+            }
+            if (deferred.manifest.tabName.empty() && (deferred.manifest.triggers & PluginAPI::ACTIVATE_ON_TAB_OPEN)) {
+                deferred.manifest.tabName = deferred.manifest.name;
+            }
+            deferred.hookFired = std::make_shared<std::atomic<bool>>(false);
+            printf("[PluginManager] Deferred %s until %s\n", pending.dllPath.c_str(), DescribeTriggers(pending.manifest).c_str());
+            fflush(stdout);
+            m_DeferredPlugins.push_back(std::move(deferred));
+            continue;
+        }
+        if (!pending.moduleHandle) {
+            printf("[PluginManager] Failed to load DLL: %s (Error: %lu)\n", pending.dllPath.c_str(), pending.error);
+            fflush(stdout);
+            PluginManifestCache::Get().RecordLoadFailure(pending.dllPath, "LoadLibrary error " + std::to_string(pending.error));
+            continue;
+        }
+        InitializePlugin(pending.moduleHandle, pending.dllPath, pending.mapMs);
+    } while (IsLoadingPlugins() && MillisecondsSince(frameStart) < PluginInitBudgetMs);
+
+    if (!IsLoadingPlugins()) {
+        // Only the DLLs actually loaded count towards the total; skipped and deferred ones are reported apart
+        size_t loaded = m_Plugins.size() - m_PluginsBeforeLoad;
+        size_t skipped = 0;
+        size_t deferred = 0;
+        for (const std::shared_ptr<PendingPlugin>& pending : m_PendingPlugins) {
+            if (!pending->skipReason.empty()) {
+                ++skipped;
+            } else if (pending->deferred) {
+                ++deferred;
+            }
+        }
+        size_t attempted = m_PendingPlugins.size() - skipped - deferred;
+        printf("[PluginManager] Loaded %zu of %zu plugin(s) in %.1f ms, %zu skipped, %zu deferred\n",
+            loaded, attempted, MillisecondsSince(m_PluginLoadStart), skipped, deferred);
+        fflush(stdout);
+        GUILogger::Get().Log("[INFO] [PluginManager] Loaded %zu of %zu plugin(s) in %.1f ms, %zu skipped, %zu deferred",
+            loaded, attempted, MillisecondsSince(m_PluginLoadStart), skipped, deferred);
+        m_PendingPlugins.clear();
+        m_NextPendingPlugin = 0;
+        PluginManifestCache::Get().Save();
+    }
+}
+
+void PluginManager::ActivateDeferredPlugin(DeferredPlugin& deferred, const char* trigger) {
+    if (deferred.activating) {
+        return;
+    }
+    deferred.activating = true;
+    printf("[PluginManager] Activating %s (%s)\n", deferred.dllPath.c_str(), trigger);
+    fflush(stdout);
+
+    // Whatever the trigger, the activation hook has done its job; remove just our callback
+    if (deferred.hookHandle) {
+        UnregisterGlobalHook(deferred.hookHandle);
+        deferred.hookHandle = 0;
+    }
+
+    auto pending = std::make_shared<PendingPlugin>();
+    pending->dllPath = deferred.dllPath;
+    pending->activation = true;
+    StartLoaderThreads(std::make_shared<std::vector<std::shared_ptr<PendingPlugin>>>(1, pending));
+}
+
+void PluginManager::UpdateDeferredPlugins() {
+    auto now = std::chrono::steady_clock::now();
+    for (DeferredPlugin& deferred : m_DeferredPlugins) {
+        const PluginManifestCache::Manifest& manifest = deferred.manifest;
+        if (deferred.activating) {
+            continue;
+        }
+
+        if ((manifest.triggers & PluginAPI::ACTIVATE_ON_HOTKEY) && manifest.activationHotkey) {
+            bool down = HotkeyManager::IsHotkeyPressed(HotkeyManager::Hotkey(manifest.activationHotkey));
+            if (down && !deferred.hotkeyWasDown) {
+                ActivateDeferredPlugin(deferred, "hotkey");
+                continue;
+            }
+            deferred.hotkeyWasDown = down;
+        }
+
+        if ((manifest.triggers & PluginAPI::ACTIVATE_ON_HOOK) && !manifest.hookClass.empty() && !manifest.hookFunction.empty()) {
+            // The call that fires the hook is not delivered to the plugin: it happens on the game
+            // thread before the DLL is even mapped, so the plugin's own hooks first see the next call
+            if (deferred.hookFired->load(std::memory_order_acquire)) {
+                ActivateDeferredPlugin(deferred, "hook");
+                continue;
+            }
+            // The hook's class may not exist yet, so registration is retried. Whether it does is a
+            // probe of the shared name table; the hook system's own check scans all of GObjects.
+            PluginAPI::NameTable& names = PluginAPI::NameTable::Get();
+            if (!deferred.hookHandle && now >= deferred.nextHookAttempt && names.IsBuilt()) {
+                deferred.nextHookAttempt = now + std::chrono::seconds(5);
+                if (names.FindClass(manifest.hookClass)) {
+                    std::shared_ptr<std::atomic<bool>> fired = deferred.hookFired;
+                    PluginAPI::PreHookCallback onCall = [fired](void*, void*, void*) {
+                        fired->store(true, std::memory_order_release);
+                    };
+                    deferred.hookHandle = RegisterGlobalHookWithHandle(manifest.hookClass.c_str(), manifest.hookFunction.c_str(), &onCall, nullptr, true);
+                    if (!deferred.hookHandle && !deferred.hookFailureLogged) {
+                        deferred.hookFailureLogged = true;
+                        GUILogger::Get().Log("[WARNING] [PluginManager] %s: cannot hook %s::%s yet, still retrying",
+                            deferred.manifest.name.c_str(), manifest.hookClass.c_str(), manifest.hookFunction.c_str());
+                    }
+                }
+            }
+        }
+    }
 }
 
 bool PluginManager::LoadPlugin(const char* dllPath) {
     printf("[PluginManager] Loading plugin: %s\n", dllPath);
     fflush(stdout);
 
-    HMODULE hModule = LoadLibraryA(dllPath);
+    auto start = std::chrono::steady_clock::now();
+    PluginManifestCache::Manifest manifest = PluginManifestCache::Get().Validate(dllPath);
+    if (manifest.status != PluginManifestCache::Status::Valid) {
+        printf("[PluginManager] Skipping %s: %s\n", dllPath, manifest.reason.c_str());
+        fflush(stdout);
+        return false;
+    }
+
+    HMODULE hModule = LoadLibraryExA(dllPath, nullptr, 0);
     if (!hModule) {
-        printf("[PluginManager] Failed to load DLL: %s (Error: %lu)\n", dllPath, GetLastError());
+        DWORD error = GetLastError();
+        printf("[PluginManager] Failed to load DLL: %s (Error: %lu)\n", dllPath, error);
         fflush(stdout);
+        PluginManifestCache::Get().RecordLoadFailure(dllPath, "LoadLibrary error " + std::to_string(error));
         return false;
     }
+    return InitializePlugin(hModule, dllPath, MillisecondsSince(start));
+}
+
+bool PluginManager::InitializePlugin(HMODULE hModule, const std::string& dllPath, double mapMs) {
+    auto start = std::chrono::steady_clock::now();
 
     typedef PluginAPI::IPlugin* (*CreatePluginFn)(const PluginAPI::MasterAPI*);
     CreatePluginFn createPlugin = (CreatePluginFn)GetProcAddress(hModule, "CreatePlugin");
 
     if (!createPlugin) {
-        printf("[PluginManager] DLL missing CreatePlugin export: %s\n", dllPath);
+        printf("[PluginManager] DLL missing CreatePlugin export: %s\n", dllPath.c_str());
         fflush(stdout);
+        PluginManifestCache::Get().RecordLoadFailure(dllPath, "CreatePlugin not found");
         FreeLibrary(hModule);
         return false;
     }
 
     PluginAPI::IPlugin* plugin = createPlugin(&m_MasterAPI);
     if (!plugin) {
-        printf("[PluginManager] CreatePlugin returned nullptr: %s\n", dllPath);
+        printf("[PluginManager] CreatePlugin returned nullptr: %s\n", dllPath.c_str());
         fflush(stdout);
+        PluginManifestCache::Get().RecordLoadFailure(dllPath, "CreatePlugin returned nullptr");
         FreeLibrary(hModule);
         return false;
     }
 
     if (!plugin->OnLoad()) {
-        printf("[PluginManager] Plugin OnLoad failed: %s\n", dllPath);
+        printf("[PluginManager] Plugin OnLoad failed: %s\n", dllPath.c_str());
         fflush(stdout);
+        PluginManifestCache::Get().RecordLoadFailure(dllPath, "OnLoad failed");
         delete plugin;
         FreeLibrary(hModule);
         return false;
@@ -346,11 +578,14 @@ bool PluginManager::LoadPlugin(const char* dllPath) {
     loadedPlugin.instance = plugin;
     loadedPlugin.dllPath = dllPath;
     loadedPlugin.isEnabled = true;
+    loadedPlugin.mapMs = mapMs;
+    loadedPlugin.initMs = MillisecondsSince(start);
 
     m_Plugins.push_back(loadedPlugin);
+    PluginManifestCache::Get().RecordLoadSuccess(dllPath, plugin->GetName(), plugin->GetVersion());
 
-    printf("[PluginManager] Successfully loaded: %s v%s by %s\n",
-        plugin->GetName(), plugin->GetVersion(), plugin->GetAuthor());
+    printf("[PluginManager] Successfully loaded: %s v%s by %s (map %.1f ms, init %.1f ms)\n",
+        plugin->GetName(), plugin->GetVersion(), plugin->GetAuthor(), loadedPlugin.mapMs, loadedPlugin.initMs);
     fflush(stdout);
 
     return true;
@@ -363,6 +598,9 @@ void PluginManager::ReloadPlugins() {
 }
 
 void PluginManager::UpdatePlugins() {
+    ProcessPendingPlugins();
+    UpdateDeferredPlugins();
+
     for (auto& plugin : m_Plugins) {
         if (plugin.isEnabled) {
             plugin.instance->OnFrame();
@@ -379,12 +617,15 @@ void PluginManager::RenderIndependentOverlays() {
 }
 
 void PluginManager::RenderPluginTabs() {
-    if (m_Plugins.empty()) {
+    if (IsLoadingPlugins()) {
+        ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "Loading plugins (%zu of %zu)...", m_NextPendingPlugin, m_PendingPlugins.size());
+        ImGui::Separator();
+    } else if (m_Plugins.empty() && m_DeferredPlugins.empty()) {
         ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "No plugins loaded");
         ImGui::Separator();
         ImGui::Text("Place plugin DLLs in the 'Plugins' folder");
         ImGui::Text("next to Plugin_Manager.dll and restart the game.");
-        return;
+        ImGui::Separator();
     }
 
     if (ImGui::BeginTabBar("PluginTabs")) {
@@ -434,6 +675,23 @@ void PluginManager::RenderPluginTabs() {
             }
         }
 
+        // Placeholders for plugins that aren't loaded yet; the real tab replaces one once loaded
+        for (DeferredPlugin& deferred : m_DeferredPlugins) {
+            if (deferred.manifest.tabName.empty()) {
+                continue;
+            }
+            if (ImGui::BeginTabItem(deferred.manifest.tabName.c_str())) {
+                RenderDeferredPlaceholder(deferred);
+                ImGui::EndTabItem();
+            }
+        }
+
+        // Built-in GObjects browser
+        if (ImGui::BeginTabItem("Objects")) {
+            ObjectBrowser::Get().Render();
+            ImGui::EndTabItem();
+        }
+
         // Info tab
         if (ImGui::BeginTabItem("Plugin Info")) {
             ImGui::TextColored(ImVec4(0.5f, 0.9f, 1.0f, 1.0f), "Loaded Plugins:");
@@ -448,12 +706,37 @@ void PluginManager::RenderPluginTabs() {
                 ImGui::Text("  Version: %s", p.instance->GetVersion());
                 ImGui::Text("  Author: %s", p.instance->GetAuthor());
                 ImGui::Text("  Description: %s", p.instance->GetDescription());
+                ImGui::Text("  Load time: %.1f ms map, %.1f ms init", p.mapMs, p.initMs);
                 ImGui::Checkbox("Enabled##checkbox", &p.isEnabled);
                 ImGui::Separator();
 
                 ImGui::PopID();
             }
 
+            if (!m_DeferredPlugins.empty()) {
+                ImGui::Spacing();
+                ImGui::TextColored(ImVec4(0.5f, 0.9f, 1.0f, 1.0f), "Not Loaded Yet:");
+                ImGui::Separator();
+                for (size_t i = 0; i < m_DeferredPlugins.size(); i++) {
+                    DeferredPlugin& deferred = m_DeferredPlugins[i];
+                    ImGui::PushID(static_cast<int>(m_Plugins.size() + i));
+                    ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "%s", deferred.manifest.name.c_str());
+                    ImGui::Text("  Loads when %s", DescribeTriggers(deferred.manifest).c_str());
+                    ImGui::BeginDisabled(deferred.activating);
+                    if (ImGui::SmallButton("Load now")) {
+                        ActivateDeferredPlugin(deferred, "manual");
+                    }
+                    ImGui::EndDisabled();
+                    ImGui::Separator();
+                    ImGui::PopID();
+                }
+            }
+
+            ImGui::Spacing();
+            ImGui::TextColored(ImVec4(0.5f, 0.9f, 1.0f, 1.0f), "Log Channels:");
+            ImGui::Separator();
+            RenderLogChannels();
+
             ImGui::EndTabItem();
         }
 
@@ -461,6 +744,78 @@ void PluginManager::RenderPluginTabs() {
     }
 }
 
+void PluginManager::RenderDeferredPlaceholder(DeferredPlugin& deferred) {
+    const PluginManifestCache::Manifest& manifest = deferred.manifest;
+    if (manifest.triggers & PluginAPI::ACTIVATE_ON_TAB_OPEN) {
+        ActivateDeferredPlugin(deferred, "tab opened");
+    }
+
+    ImGui::TextColored(ImVec4(0.3f, 0.9f, 1.0f, 1.0f), "%s", manifest.name.c_str());
+    ImGui::Text("Version: %s", manifest.version.c_str());
+    ImGui::Text("Author: %s", manifest.author.c_str());
+    if (!manifest.description.empty()) {
+        ImGui::Spacing();
+        ImGui::TextWrapped("%s", manifest.description.c_str());
+    }
+    ImGui::Separator();
+
+    if (deferred.activating) {
+        ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "Loading...");
+        return;
+    }
+    ImGui::TextWrapped("Not loaded yet; loads when %s.", DescribeTriggers(manifest).c_str());
+    if (ImGui::Button("Load now")) {
+        ActivateDeferredPlugin(deferred, "manual");
+    }
+}
+
+PluginAPI::LogChannel* PluginManager::RegisterLogChannel(const char* name) {
+    if (!name || !*name) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(m_LogChannelsMutex);
+    for (auto& channel : m_LogChannels) {
+        if (strncmp(channel->name, name, sizeof(channel->name) - 1) == 0) {
+            return channel.get();
+        }
+    }
+
+    auto channel = std::make_unique<PluginAPI::LogChannel>();
+    strncpy_s(channel->name, name, _TRUNCATE);
+    // Errors, warnings and info by default; debug/trace are opt-in from the GUI
+    channel->levelMask.store((1u << (PluginAPI::LOG_LEVEL_INFO + 1)) - 1, std::memory_order_relaxed);
+    m_LogChannels.push_back(std::move(channel));
+
+    GUILogger::Get().Log("[PluginManager] Registered log channel: %s", m_LogChannels.back()->name);
+    return m_LogChannels.back().get();
+}
+
+void PluginManager::RenderLogChannels() {
+    static const char* const verbosityNames[] = { "Off", "Error", "Warning", "Info", "Debug", "Trace" };
+
+    std::lock_guard<std::mutex> lock(m_LogChannelsMutex);
+    if (m_LogChannels.empty()) {
+        ImGui::TextDisabled("No plugin has registered a log channel.");
+        return;
+    }
+
+    for (auto& channel : m_LogChannels) {
+        // Masks set through the GUI are always "this level and everything more severe"
+        uint32_t mask = channel->levelMask.load(std::memory_order_relaxed);
+        int verbosity = 0;
+        while (verbosity < PluginAPI::LOG_LEVEL_COUNT && (mask & (1u << verbosity))) {
+            ++verbosity;
+        }
+
+        ImGui::SetNextItemWidth(120.0f);
+        if (ImGui::Combo(channel->name, &verbosity, verbosityNames, IM_ARRAYSIZE(verbosityNames))) {
+            channel->levelMask.store((1u << verbosity) - 1, std::memory_order_relaxed);
+            GUILogger::Get().Log("[PluginManager] Log channel %s verbosity: %s", channel->name, verbosityNames[verbosity]);
+        }
+    }
+}
+
 PluginAPI::IPlugin* PluginManager::GetPlugin(size_t index) {
     if (index >= m_Plugins.size()) return nullptr;
     return m_Plugins[index].instance;
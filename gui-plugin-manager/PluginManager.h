@@ -1,7 +1,12 @@
 #pragma once
 #include "PluginLib/PluginAPI.h"
+#include "PluginManifestCache.h"
 #include <vector>
 #include <string>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <chrono>
 #include <Windows.h>
 #include "imgui/imgui.h"
 
@@ -12,11 +17,51 @@ private:
         PluginAPI::IPlugin* instance;
         std::string dllPath;
         bool isEnabled;
+        double mapMs = 0.0;     // LoadLibraryExA, on a loader thread
+        double initMs = 0.0;    // CreatePlugin + OnLoad, on the render thread
+    };
+
+    // A DLL being mapped by a loader thread; initialized in path order once mapped
+    struct PendingPlugin {
+        std::string dllPath;
+        HMODULE moduleHandle = nullptr;
+        DWORD error = 0;
+        std::string skipReason;     // set instead of loading when the manifest is invalid
+        bool activation = false;    // a deferred plugin whose trigger fired: load regardless of triggers
+        bool deferred = false;      // set instead of loading when the manifest defers activation
+        PluginManifestCache::Manifest manifest;
+        double mapMs = 0.0;
+        std::atomic<bool> mapped{ false };
+        std::atomic<bool> abandoned{ false };   // set by Shutdown: a loader thread that hasn't mapped it yet won't
+    };
+
+    // A plugin that isn't loaded until one of its manifest's triggers fires; until then its tab
+    // is a placeholder built from the cached manifest
+    struct DeferredPlugin {
+        std::string dllPath;
+        PluginManifestCache::Manifest manifest;
+        std::shared_ptr<std::atomic<bool>> hookFired;   // set by the activation hook, on the game thread
+        uint64_t hookHandle = 0;                        // that hook's registration, 0 until registered
+        bool hookFailureLogged = false;                 // the class exists but registering failed once
+        std::chrono::steady_clock::time_point nextHookAttempt;
+        bool hotkeyWasDown = false;
+        bool activating = false;
     };
 
     std::vector<LoadedPlugin> m_Plugins;
+
+    // Pending entries are shared with the (detached) loader threads, hence shared_ptr
+    std::vector<std::shared_ptr<PendingPlugin>> m_PendingPlugins;
+    size_t m_NextPendingPlugin = 0;
+    size_t m_PluginsBeforeLoad = 0;
+    std::chrono::steady_clock::time_point m_PluginLoadStart;
+    std::vector<DeferredPlugin> m_DeferredPlugins;
     PluginAPI::MasterAPI m_MasterAPI;
 
+    // Channels are handed out by pointer, so they are never moved or freed
+    std::vector<std::unique_ptr<PluginAPI::LogChannel>> m_LogChannels;
+    std::mutex m_LogChannelsMutex;
+
 public:
     ImGuiContext* m_ImGuiContext;
 
@@ -27,6 +72,12 @@ private:
 
     // Helper methods
     void SetupMasterAPI();
+    bool InitializePlugin(HMODULE hModule, const std::string& dllPath, double mapMs);
+    void StartLoaderThreads(std::shared_ptr<std::vector<std::shared_ptr<PendingPlugin>>> queue);
+    void ProcessPendingPlugins();
+    void UpdateDeferredPlugins();
+    void ActivateDeferredPlugin(DeferredPlugin& deferred, const char* trigger);
+    void RenderDeferredPlaceholder(DeferredPlugin& deferred);
 
 public:
     // Singleton
@@ -35,8 +86,13 @@ public:
     // Plugin management
     void Initialize(ImGuiContext* imguiCtx);
     void Shutdown();
+    // Maps every DLL in the directory in parallel; UpdatePlugins then creates and loads them
+    // in path order, a few per frame, so the first frames don't stall on plugin startup.
+    // Plugins whose manifest defers activation are only loaded once a trigger fires.
     void LoadPluginsFromDirectory(const char* directory);
+    // Synchronous: map, create and load one plugin now
     bool LoadPlugin(const char* dllPath);
+    bool IsLoadingPlugins() const { return m_NextPendingPlugin < m_PendingPlugins.size(); }
     void ReloadPlugins();
 
     // Called every frame
@@ -45,6 +101,10 @@ public:
     // UI Rendering
     void RenderPluginTabs();
     void RenderIndependentOverlays();
+    void RenderLogChannels();
+
+    // Log channels (MasterAPI::RegisterLogChannel)
+    PluginAPI::LogChannel* RegisterLogChannel(const char* name);
 
     // Getters
     size_t GetPluginCount() const { return m_Plugins.size(); }
@@ -0,0 +1,504 @@
+#include "stdafx.h"
+#include "PluginManifestCache.h"
+#include "PluginLib/PluginAPI.h"
+#include <algorithm>
+#include <cctype>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+// Plugins declare the API they were built against with PLUGIN_DECLARE_API_VERSION()
+constexpr const char* ApiVersionExport = "PluginApiVersion";
+constexpr const char* ManifestExport = "PluginManifest";
+constexpr const char* CreatePluginExport = "CreatePlugin";
+constexpr uint32_t MaxExportNames = 4096;
+// Bumped when entries gain fields; a cache written by another format is discarded
+constexpr int CacheFormatVersion = 2;
+
+uint64_t HashBytes(const std::vector<uint8_t>& bytes) {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (uint8_t byte : bytes) {
+        hash ^= byte;
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+template <typename T>
+bool ReadAt(const std::vector<uint8_t>& image, uint64_t offset, T& out) {
+    if (offset > image.size() || image.size() - offset < sizeof(T)) {
+        return false;
+    }
+    std::memcpy(&out, image.data() + offset, sizeof(T));
+    return true;
+}
+
+// File offset of an RVA, via the section that contains it
+bool RvaToOffset(const std::vector<IMAGE_SECTION_HEADER>& sections, uint32_t rva, uint64_t& outOffset) {
+    for (const IMAGE_SECTION_HEADER& section : sections) {
+        uint32_t size = (std::max)(section.Misc.VirtualSize, section.SizeOfRawData);
+        if (rva >= section.VirtualAddress && rva - section.VirtualAddress < size) {
+            uint32_t delta = rva - section.VirtualAddress;
+            if (delta >= section.SizeOfRawData) {
+                return false;  // uninitialized data; nothing on disk to read
+            }
+            outOffset = static_cast<uint64_t>(section.PointerToRawData) + delta;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ReadFileBytes(const std::string& path, std::vector<uint8_t>& out) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::streamsize size = file.tellg();
+    if (size < 0) {
+        return false;
+    }
+    out.resize(static_cast<size_t>(size));
+    file.seekg(0);
+    return size == 0 || static_cast<bool>(file.read(reinterpret_cast<char*>(out.data()), size));
+}
+
+std::string OneLine(const std::string& text) {
+    std::string line = text;
+    std::replace(line.begin(), line.end(), '\n', ' ');
+    std::replace(line.begin(), line.end(), '\r', ' ');
+    return line;
+}
+
+// Fixed-size manifest string; not trusted to be terminated
+template <size_t N>
+std::string FieldString(const char (&field)[N]) {
+    return std::string(field, strnlen(field, N));
+}
+
+void ApplyDeclaredManifest(const PluginAPI::PluginManifest& declared, PluginManifestCache::Manifest& manifest) {
+    manifest.hasManifest = true;
+    manifest.triggers = declared.triggers;
+    manifest.name = FieldString(declared.name);
+    manifest.version = FieldString(declared.version);
+    manifest.author = FieldString(declared.author);
+    manifest.description = FieldString(declared.description);
+    manifest.tabName = FieldString(declared.tabName);
+    manifest.activationHotkey = declared.activationHotkey;
+    manifest.hookClass = FieldString(declared.hookClass);
+    manifest.hookFunction = FieldString(declared.hookFunction);
+}
+
+const char* StatusName(PluginManifestCache::Status status) {
+    return status == PluginManifestCache::Status::Valid ? "Valid" : "Invalid";
+}
+
+}  // namespace
+
+bool PluginManifestCache::Manifest::ActivatesOnStartup() const {
+    return !hasManifest || triggers == 0 || (triggers & PluginAPI::ACTIVATE_ON_STARTUP);
+}
+
+bool PluginManifestCache::ReadExports(const std::vector<uint8_t>& image, Manifest& manifest, std::string& outError) {
+    std::vector<std::string>& outExports = manifest.exports;
+    outExports.clear();
+    manifest.apiVersion = 0;
+
+    IMAGE_DOS_HEADER dos{};
+    if (!ReadAt(image, 0, dos) || dos.e_magic != IMAGE_DOS_SIGNATURE || dos.e_lfanew <= 0) {
+        outError = "not a PE image";
+        return false;
+    }
+
+    const uint64_t ntOffset = static_cast<uint64_t>(dos.e_lfanew);
+    DWORD signature = 0;
+    IMAGE_FILE_HEADER fileHeader{};
+    WORD optionalMagic = 0;
+    if (!ReadAt(image, ntOffset, signature) || signature != IMAGE_NT_SIGNATURE ||
+        !ReadAt(image, ntOffset + sizeof(DWORD), fileHeader) ||
+        !ReadAt(image, ntOffset + sizeof(DWORD) + sizeof(IMAGE_FILE_HEADER), optionalMagic)) {
+        outError = "not a PE image";
+        return false;
+    }
+    if (!(fileHeader.Characteristics & IMAGE_FILE_DLL)) {
+        outError = "not a DLL";
+        return false;
+    }
+
+    // The export directory entry sits at a different offset in PE32 and PE32+ optional headers
+    const uint64_t optionalOffset = ntOffset + sizeof(DWORD) + sizeof(IMAGE_FILE_HEADER);
+    IMAGE_DATA_DIRECTORY exportDir{};
+    if (optionalMagic == IMAGE_NT_OPTIONAL_HDR64_MAGIC) {
+        IMAGE_OPTIONAL_HEADER64 optional{};
+        if (!ReadAt(image, optionalOffset, optional) || optional.NumberOfRvaAndSizes <= IMAGE_DIRECTORY_ENTRY_EXPORT) {
+            outError = "truncated optional header";
+            return false;
+        }
+        exportDir = optional.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT];
+    } else if (optionalMagic == IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
+        IMAGE_OPTIONAL_HEADER32 optional{};
+        if (!ReadAt(image, optionalOffset, optional) || optional.NumberOfRvaAndSizes <= IMAGE_DIRECTORY_ENTRY_EXPORT) {
+            outError = "truncated optional header";
+            return false;
+        }
+        exportDir = optional.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT];
+    } else {
+        outError = "unknown optional header";
+        return false;
+    }
+
+    std::vector<IMAGE_SECTION_HEADER> sections(fileHeader.NumberOfSections);
+    const uint64_t sectionOffset = optionalOffset + fileHeader.SizeOfOptionalHeader;
+    for (WORD i = 0; i < fileHeader.NumberOfSections; ++i) {
+        if (!ReadAt(image, sectionOffset + i * sizeof(IMAGE_SECTION_HEADER), sections[i])) {
+            outError = "truncated section table";
+            return false;
+        }
+    }
+
+    if (exportDir.VirtualAddress == 0 || exportDir.Size == 0) {
+        return true;  // a valid DLL without exports
+    }
+
+    uint64_t offset = 0;
+    IMAGE_EXPORT_DIRECTORY exports{};
+    if (!RvaToOffset(sections, exportDir.VirtualAddress, offset) || !ReadAt(image, offset, exports)) {
+        outError = "unreadable export directory";
+        return false;
+    }
+
+    uint64_t namesOffset = 0;
+    uint64_t ordinalsOffset = 0;
+    uint64_t functionsOffset = 0;
+    const uint32_t nameCount = (std::min)(static_cast<uint32_t>(exports.NumberOfNames), MaxExportNames);
+    if (nameCount > 0 &&
+        (!RvaToOffset(sections, exports.AddressOfNames, namesOffset) ||
+         !RvaToOffset(sections, exports.AddressOfNameOrdinals, ordinalsOffset) ||
+         !RvaToOffset(sections, exports.AddressOfFunctions, functionsOffset))) {
+        outError = "unreadable export tables";
+        return false;
+    }
+
+    for (uint32_t i = 0; i < nameCount; ++i) {
+        uint32_t nameRva = 0;
+        uint64_t nameOffset = 0;
+        if (!ReadAt(image, namesOffset + i * sizeof(uint32_t), nameRva) || !RvaToOffset(sections, nameRva, nameOffset) ||
+            nameOffset >= image.size()) {
+            continue;
+        }
+        const char* begin = reinterpret_cast<const char*>(image.data() + nameOffset);
+        const char* end = static_cast<const char*>(std::memchr(begin, '\0', image.size() - nameOffset));
+        if (!end) {
+            continue;
+        }
+        outExports.emplace_back(begin, end);
+
+        const bool isApiVersion = outExports.back() == ApiVersionExport;
+        const bool isManifest = outExports.back() == ManifestExport;
+        if (!isApiVersion && !isManifest) {
+            continue;
+        }
+        // Exported data: the function table entry is the variable's RVA (unless it's a forwarder)
+        uint16_t ordinal = 0;
+        uint32_t valueRva = 0;
+        uint64_t valueOffset = 0;
+        if (!ReadAt(image, ordinalsOffset + i * sizeof(uint16_t), ordinal) || ordinal >= exports.NumberOfFunctions ||
+            !ReadAt(image, functionsOffset + ordinal * sizeof(uint32_t), valueRva) ||
+            (valueRva >= exportDir.VirtualAddress && valueRva - exportDir.VirtualAddress < exportDir.Size) ||
+            !RvaToOffset(sections, valueRva, valueOffset)) {
+            continue;
+        }
+
+        if (isApiVersion) {
+            int32_t value = 0;
+            if (ReadAt(image, valueOffset, value)) {
+                manifest.apiVersion = value;
+            }
+        } else {
+            // A manifest from a different header version is ignored rather than misread
+            PluginAPI::PluginManifest declared{};
+            if (ReadAt(image, valueOffset, declared) && declared.size == sizeof(PluginAPI::PluginManifest)) {
+                ApplyDeclaredManifest(declared, manifest);
+            }
+        }
+    }
+    return true;
+}
+
+std::string PluginManifestCache::NormalizePath(const std::string& path) {
+    std::string normalized = std::filesystem::path(path).lexically_normal().string();
+    for (char& c : normalized) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return normalized;
+}
+
+void PluginManifestCache::Load(const std::string& cachePath) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_CachePath = cachePath;
+    m_Manifests.clear();
+    m_Dirty = false;
+
+    std::ifstream file(cachePath);
+    if (!file.is_open()) {
+        return;
+    }
+
+    std::string line;
+    if (!std::getline(file, line) || line != "Version=" + std::to_string(CacheFormatVersion)) {
+        m_Dirty = true;  // other format: start over, rewrite on Save
+        return;
+    }
+    // Cached Valid/Invalid verdicts compare each plugin's ApiVersion with the loader that wrote
+    // them; after a loader update they are re-derived from the files instead of reused
+    if (!std::getline(file, line) || line != "LoaderApiVersion=" + std::to_string(PluginAPI::API_VERSION)) {
+        GUILogger::Get().Log("[INFO] [PluginManifestCache] Cache was written for another plugin API version; re-validating all plugins");
+        m_Dirty = true;
+        return;
+    }
+
+    Manifest current;
+    auto commit = [&]() {
+        if (!current.path.empty()) {
+            m_Manifests[NormalizePath(current.path)] = current;
+        }
+        current = Manifest();
+    };
+
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line[0] == ';') {
+            continue;
+        }
+        if (line == "[Plugin]") {
+            commit();
+            continue;
+        }
+
+        size_t eqPos = line.find('=');
+        if (eqPos == std::string::npos) {
+            continue;
+        }
+        std::string key = line.substr(0, eqPos);
+        std::string value = line.substr(eqPos + 1);
+        try {
+            if (key == "Path") {
+                current.path = value;
+            } else if (key == "Size") {
+                current.size = std::stoull(value);
+            } else if (key == "WriteTime") {
+                current.writeTime = std::stoll(value);
+            } else if (key == "Hash") {
+                current.hash = std::stoull(value, nullptr, 16);
+            } else if (key == "Status") {
+                current.status = value == "Valid" ? Status::Valid : Status::Invalid;
+            } else if (key == "Reason") {
+                current.reason = value;
+            } else if (key == "Exports") {
+                std::stringstream names(value);
+                std::string name;
+                while (std::getline(names, name, ',')) {
+                    if (!name.empty()) {
+                        current.exports.push_back(name);
+                    }
+                }
+            } else if (key == "ApiVersion") {
+                current.apiVersion = std::stoi(value);
+            } else if (key == "Name") {
+                current.name = value;
+            } else if (key == "Version") {
+                current.version = value;
+            } else if (key == "LastLoadTime") {
+                current.lastLoadTime = std::stoll(value);
+            } else if (key == "HasManifest") {
+                current.hasManifest = value == "1";
+            } else if (key == "Triggers") {
+                current.triggers = static_cast<uint32_t>(std::stoul(value));
+            } else if (key == "Author") {
+                current.author = value;
+            } else if (key == "Description") {
+                current.description = value;
+            } else if (key == "TabName") {
+                current.tabName = value;
+            } else if (key == "ActivationHotkey") {
+                current.activationHotkey = std::stoi(value);
+            } else if (key == "HookClass") {
+                current.hookClass = value;
+            } else if (key == "HookFunction") {
+                current.hookFunction = value;
+            }
+        } catch (...) {
+            // A damaged value only costs this entry a re-validation
+            current.size = 0;
+        }
+    }
+    commit();
+}
+
+bool PluginManifestCache::Save() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (!m_Dirty || m_CachePath.empty()) {
+        return true;
+    }
+
+    std::error_code ec;
+    std::filesystem::path parent = std::filesystem::path(m_CachePath).parent_path();
+    if (!parent.empty()) {
+        std::filesystem::create_directories(parent, ec);
+    }
+    std::ofstream file(m_CachePath, std::ios::trunc);
+    if (!file.is_open()) {
+        GUILogger::Get().Log("[ERROR] [PluginManifestCache] Could not write %s", m_CachePath.c_str());
+        return false;
+    }
+
+    file << "Version=" << CacheFormatVersion << "\n";
+    file << "LoaderApiVersion=" << PluginAPI::API_VERSION << "\n";
+    file << "; Plugin manifest cache - auto-generated, safe to delete\n";
+    for (const auto& [key, manifest] : m_Manifests) {
+        file << "\n[Plugin]\n";
+        file << "Path=" << manifest.path << "\n";
+        file << "Size=" << manifest.size << "\n";
+        file << "WriteTime=" << manifest.writeTime << "\n";
+        file << "Hash=" << std::hex << manifest.hash << std::dec << "\n";
+        file << "Status=" << StatusName(manifest.status) << "\n";
+        file << "Reason=" << OneLine(manifest.reason) << "\n";
+        file << "Exports=";
+        for (size_t i = 0; i < manifest.exports.size(); ++i) {
+            file << (i ? "," : "") << manifest.exports[i];
+        }
+        file << "\n";
+        file << "ApiVersion=" << manifest.apiVersion << "\n";
+        file << "Name=" << OneLine(manifest.name) << "\n";
+        file << "Version=" << OneLine(manifest.version) << "\n";
+        file << "LastLoadTime=" << manifest.lastLoadTime << "\n";
+        file << "HasManifest=" << (manifest.hasManifest ? 1 : 0) << "\n";
+        file << "Triggers=" << manifest.triggers << "\n";
+        file << "Author=" << OneLine(manifest.author) << "\n";
+        file << "Description=" << OneLine(manifest.description) << "\n";
+        file << "TabName=" << OneLine(manifest.tabName) << "\n";
+        file << "ActivationHotkey=" << manifest.activationHotkey << "\n";
+        file << "HookClass=" << OneLine(manifest.hookClass) << "\n";
+        file << "HookFunction=" << OneLine(manifest.hookFunction) << "\n";
+    }
+    m_Dirty = false;
+    return true;
+}
+
+PluginManifestCache::Manifest PluginManifestCache::Validate(const std::string& dllPath) {
+    const std::string key = NormalizePath(dllPath);
+
+    Manifest manifest;
+    manifest.path = dllPath;
+    std::error_code ec;
+    manifest.size = std::filesystem::file_size(dllPath, ec);
+    if (!ec) {
+        manifest.writeTime = std::filesystem::last_write_time(dllPath, ec).time_since_epoch().count();
+    }
+    if (ec) {
+        manifest.reason = "file not accessible";
+        return manifest;
+    }
+
+    std::optional<Manifest> cached;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_Manifests.find(key);
+        if (it != m_Manifests.end()) {
+            if (it->second.size == manifest.size && it->second.writeTime == manifest.writeTime) {
+                return it->second;
+            }
+            cached = it->second;
+        }
+    }
+
+    // New or changed: hash and parse the file outside the lock
+    std::vector<uint8_t> image;
+    if (!ReadFileBytes(dllPath, image)) {
+        manifest.reason = "file not readable";
+        return manifest;
+    }
+    manifest.hash = HashBytes(image);
+
+    if (cached && cached->hash == manifest.hash) {
+        // Touched but identical: keep what is known, including the plugin's name and load history
+        Manifest touched = *cached;
+        touched.writeTime = manifest.writeTime;
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Manifests[key] = touched;
+        m_Dirty = true;
+        return touched;
+    }
+
+    std::string error;
+    if (!ReadExports(image, manifest, error)) {
+        manifest.reason = error;
+    } else if (std::find(manifest.exports.begin(), manifest.exports.end(), CreatePluginExport) == manifest.exports.end()) {
+        manifest.reason = "no CreatePlugin export";
+    } else if (manifest.apiVersion > PluginAPI::API_VERSION) {
+        manifest.reason = "built for plugin API v" + std::to_string(manifest.apiVersion) +
+                          ", loader provides v" + std::to_string(PluginAPI::API_VERSION);
+    } else {
+        manifest.status = Status::Valid;
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Manifests[key] = manifest;
+    m_Dirty = true;
+    return manifest;
+}
+
+void PluginManifestCache::RecordLoadSuccess(const std::string& dllPath, const char* name, const char* version) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto it = m_Manifests.find(NormalizePath(dllPath));
+    if (it == m_Manifests.end()) {
+        return;
+    }
+    it->second.name = name ? name : "";
+    it->second.version = version ? version : "";
+    it->second.reason.clear();
+    it->second.lastLoadTime = static_cast<int64_t>(std::time(nullptr));
+    m_Dirty = true;
+}
+
+void PluginManifestCache::RecordLoadFailure(const std::string& dllPath, const std::string& reason) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto it = m_Manifests.find(NormalizePath(dllPath));
+    if (it == m_Manifests.end()) {
+        return;
+    }
+    it->second.reason = reason;
+    m_Dirty = true;
+}
+
+std::optional<PluginManifestCache::Manifest> PluginManifestCache::Find(const std::string& dllPath) const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto it = m_Manifests.find(NormalizePath(dllPath));
+    if (it == m_Manifests.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void PluginManifestCache::Retain(const std::vector<std::string>& dllPaths) {
+    std::vector<std::string> keep;
+    keep.reserve(dllPaths.size());
+    for (const std::string& path : dllPaths) {
+        keep.push_back(NormalizePath(path));
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for (auto it = m_Manifests.begin(); it != m_Manifests.end();) {
+        if (std::find(keep.begin(), keep.end(), it->first) == keep.end()) {
+            it = m_Manifests.erase(it);
+            m_Dirty = true;
+        } else {
+            ++it;
+        }
+    }
+}
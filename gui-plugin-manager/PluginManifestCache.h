@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Persistent cache of what is known about each DLL in Plugins\, so the loader can validate a
+// plugin without loading it. A DLL's export table (and the value of its optional
+// PluginApiVersion export) is read straight from the file, never by running its code; the
+// result is cached per path together with the file's size, write time and FNV-1a content
+// hash. A later launch reuses the entry while size and write time are unchanged, and after a
+// touch-only change once the hash matches, so unchanged plugins are neither re-read nor re-parsed.
+// The cache records the plugin API version of the loader that wrote it and is dropped when that
+// differs, so a verdict against an older or newer API_VERSION is never reused.
+//
+// A plugin's exported PluginManifest (activation triggers and display metadata) is read the
+// same way, and the name and version reported by the plugin and the time of its last
+// successful load are recorded too, which lets the loader describe a plugin and decide when to
+// load it without running it.
+class PluginManifestCache {
+public:
+    enum class Status {
+        Valid,          // has CreatePlugin and a compatible (or no) PluginApiVersion
+        Invalid,        // not a DLL, no CreatePlugin export, or built for a newer plugin API
+    };
+
+    struct Manifest {
+        std::string path;
+        uint64_t size = 0;
+        int64_t writeTime = 0;
+        uint64_t hash = 0;
+        Status status = Status::Invalid;
+        std::string reason;                 // why Invalid, or why the last load failed
+        std::vector<std::string> exports;
+        int apiVersion = 0;                 // 0 = no PluginApiVersion export (older plugins)
+        std::string name;                   // manifest's, then as reported by the plugin at its last load
+        std::string version;
+        int64_t lastLoadTime = 0;           // unix time of the last successful load, 0 = never
+
+        // From the exported PluginManifest; without one a plugin activates on startup
+        bool hasManifest = false;
+        uint32_t triggers = 0;              // PluginAPI::ActivationTrigger flags
+        std::string author;
+        std::string description;
+        std::string tabName;
+        int activationHotkey = 0;
+        std::string hookClass;
+        std::string hookFunction;
+
+        bool ActivatesOnStartup() const;
+    };
+
+    static PluginManifestCache& Get() {
+        static PluginManifestCache instance;
+        return instance;
+    }
+
+    // Reads the cache file; a missing or unreadable file just starts an empty cache
+    void Load(const std::string& cachePath);
+    // Writes the cache back if anything changed since Load
+    bool Save();
+
+    // Manifest for dllPath, from the cache if the file is unchanged, otherwise by reading it.
+    // Thread-safe; the file is read and parsed outside the lock.
+    Manifest Validate(const std::string& dllPath);
+
+    void RecordLoadSuccess(const std::string& dllPath, const char* name, const char* version);
+    void RecordLoadFailure(const std::string& dllPath, const std::string& reason);
+
+    std::optional<Manifest> Find(const std::string& dllPath) const;
+
+    // Drop entries for DLLs that are no longer in dllPaths
+    void Retain(const std::vector<std::string>& dllPaths);
+
+    // Export names, PluginApiVersion and PluginManifest of a PE image read from disk into
+    // manifest; false if it isn't a DLL
+    static bool ReadExports(const std::vector<uint8_t>& image, Manifest& manifest, std::string& outError);
+
+private:
+    PluginManifestCache() = default;
+    PluginManifestCache(const PluginManifestCache&) = delete;
+    PluginManifestCache& operator=(const PluginManifestCache&) = delete;
+
+    static std::string NormalizePath(const std::string& path);
+
+    mutable std::mutex m_Mutex;
+    std::unordered_map<std::string, Manifest> m_Manifests;  // by normalized path
+    std::string m_CachePath;
+    bool m_Dirty = false;
+};
@@ -2,17 +2,11 @@
 #include "Settings.h"
 #include "GUILogger.h"
 #include <filesystem>
+#include <fstream>
+#include <sstream>
 
 bool Settings::Load(const std::string& configPath) {
-    // Get the directory where the game exe is located
-    std::string fullPath = configPath;
-    if (configPath.find(':') == std::string::npos && configPath.find("\\\\") != 0) {
-        // Relative path - make it relative to the game executable directory
-        char exePath[MAX_PATH];
-        GetModuleFileNameA(nullptr, exePath, MAX_PATH);
-        std::filesystem::path exeDir = std::filesystem::path(exePath).parent_path();
-        fullPath = (exeDir / configPath).string();
-    }
+    std::string fullPath = ResolvePath(configPath);
 
     std::ifstream file(fullPath);
     if (!file.is_open()) {
@@ -20,6 +14,9 @@ bool Settings::Load(const std::string& configPath) {
         return Save(fullPath);
     }
 
+    // Parse into a copy and publish it at the end, so readers never see a half-loaded config
+    Config config = *GetConfig();
+
     std::string line;
     std::string currentSection;
 
@@ -58,24 +55,27 @@ bool Settings::Load(const std::string& configPath) {
             else if (key == "LogFilePath") {
                 config.logFilePath = value;
             }
+            else if (key == "FlushIntervalMs") {
+                try { config.logFlushIntervalMs = std::stoi(value); } catch (...) {}
+            }
+            else if (key == "FlushThresholdKB") {
+                try { config.logFlushThresholdKB = std::stoi(value); } catch (...) {}
+            }
         }
     }
 
     file.close();
+    SetConfig(config);
+    ApplyLogFlushPolicy(config);
     GUILogger::Get().Log("[Settings] Configuration loaded from %s\n", fullPath.c_str());
     return true;
 }
 
 bool Settings::Save(const std::string& configPath) {
-    // Get the directory where the game exe is located
-    std::string fullPath = configPath;
-    if (configPath.find(':') == std::string::npos && configPath.find("\\\\") != 0) {
-        // Relative path - make it relative to the game executable directory
-        char exePath[MAX_PATH];
-        GetModuleFileNameA(nullptr, exePath, MAX_PATH);
-        std::filesystem::path exeDir = std::filesystem::path(exePath).parent_path();
-        fullPath = (exeDir / configPath).string();
-    }
+    std::string fullPath = ResolvePath(configPath);
+
+    std::shared_ptr<const Config> snapshot = GetConfig();
+    const Config& config = *snapshot;
 
     std::ofstream file(fullPath, std::ios::trunc);
     if (!file.is_open()) {
@@ -98,13 +98,41 @@ bool Settings::Save(const std::string& configPath) {
     file << "EnableLogging=" << (config.enableLogging ? "true" : "false") << "\n\n";
 
     file << "; Path to log file\n";
-    file << "LogFilePath=" << config.logFilePath << "\n";
+    file << "LogFilePath=" << config.logFilePath << "\n\n";
+
+    file << "; Log lines are batched in memory and written out every FlushIntervalMs,\n";
+    file << "; or as soon as FlushThresholdKB are pending\n";
+    file << "FlushIntervalMs=" << config.logFlushIntervalMs << "\n";
+    file << "FlushThresholdKB=" << config.logFlushThresholdKB << "\n";
 
     file.close();
     GUILogger::Get().Log("[Settings] Configuration saved to %s\n", fullPath.c_str());
     return true;
 }
 
+void Settings::ApplyLogFlushPolicy(const Config& config) {
+    uint32_t intervalMs = static_cast<uint32_t>((std::max)(config.logFlushIntervalMs, 1));
+    size_t thresholdBytes = static_cast<size_t>((std::max)(config.logFlushThresholdKB, 1)) * 1024;
+    GUILogger::Get().SetFlushPolicy(intervalMs, thresholdBytes);
+}
+
+bool Settings::StartWatching(const std::string& configPath) {
+    std::string fullPath = ResolvePath(configPath);
+    bool started = watcher.Start(fullPath, [this, fullPath]() {
+        GUILogger::Get().Log("[Settings] %s changed on disk, reloading\n", fullPath.c_str());
+        Load(fullPath);
+    });
+
+    if (!started) {
+        GUILogger::Get().Log("[Settings] Failed to watch %s for changes\n", fullPath.c_str());
+    }
+    return started;
+}
+
+void Settings::StopWatching() {
+    watcher.Stop();
+}
+
 bool Settings::ParseBool(const std::string& value) {
     std::string lower = value;
     std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
@@ -178,3 +206,15 @@ std::string Settings::Trim(const std::string& str) {
     size_t last = str.find_last_not_of(" \t\r\n");
     return str.substr(first, (last - first + 1));
 }
+
+std::string Settings::ResolvePath(const std::string& configPath) {
+    if (configPath.find(':') != std::string::npos || configPath.find("\\\\") == 0) {
+        return configPath;
+    }
+
+    // Relative path - make it relative to the game executable directory
+    char exePath[MAX_PATH];
+    GetModuleFileNameA(nullptr, exePath, MAX_PATH);
+    std::filesystem::path exeDir = std::filesystem::path(exePath).parent_path();
+    return (exeDir / configPath).string();
+}
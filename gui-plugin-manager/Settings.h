@@ -5,6 +5,8 @@
 #include <sstream>
 #include <algorithm>
 
+#include "../plugin_manager_base/Plugin_Manager_Base_SDK/ConfigWatcher.h"
+
 class Settings {
 public:
     struct Config {
@@ -12,6 +14,8 @@ public:
         int menuHotkey = VK_F1;
         bool enableLogging = true;
         std::string logFilePath = "Plugin_Manager/settings/Plugin_Manager_GUI.log";
+        int logFlushIntervalMs = 100;
+        int logFlushThresholdKB = 64;
     };
 
     static Settings& Get() {
@@ -22,17 +26,22 @@ public:
     bool Load(const std::string& configPath = "Plugin_Manager/settings/plugin_manager_config.ini");
     bool Save(const std::string& configPath = "Plugin_Manager/settings/plugin_manager_config.ini");
 
-    const Config& GetConfig() const { return config; }
-    void SetConfig(const Config& newConfig) { config = newConfig; }
+    // Reload the file whenever it changes on disk
+    bool StartWatching(const std::string& configPath = "Plugin_Manager/settings/plugin_manager_config.ini");
+    void StopWatching();
+
+    // Immutable snapshot, safe to read from any thread (one atomic load, e.g. in the Present hook)
+    std::shared_ptr<const Config> GetConfig() const { return configState.Get(); }
+    void SetConfig(const Config& newConfig) { configState.Publish(std::make_unique<Config>(newConfig)); }
 
-    bool GetShowDebugWindow() const { return config.showDebugWindow; }
-    void SetShowDebugWindow(bool show) { config.showDebugWindow = show; }
+    bool GetShowDebugWindow() const { return GetConfig()->showDebugWindow; }
+    void SetShowDebugWindow(bool show) { Config next = *GetConfig(); next.showDebugWindow = show; SetConfig(next); }
 
-    int GetMenuHotkey() const { return config.menuHotkey; }
-    void SetMenuHotkey(int key) { config.menuHotkey = key; }
+    int GetMenuHotkey() const { return GetConfig()->menuHotkey; }
+    void SetMenuHotkey(int key) { Config next = *GetConfig(); next.menuHotkey = key; SetConfig(next); }
 
-    bool GetEnableLogging() const { return config.enableLogging; }
-    void SetEnableLogging(bool enable) { config.enableLogging = enable; }
+    bool GetEnableLogging() const { return GetConfig()->enableLogging; }
+    void SetEnableLogging(bool enable) { Config next = *GetConfig(); next.enableLogging = enable; SetConfig(next); }
 
     std::string VirtualKeyToString(int vkey);
 
@@ -45,6 +54,9 @@ private:
     bool ParseBool(const std::string& value);
     int ParseVirtualKey(const std::string& value);
     std::string Trim(const std::string& str);
+    std::string ResolvePath(const std::string& configPath);
+    void ApplyLogFlushPolicy(const Config& config);
 
-    Config config;
+    AtomicConfig<Config> configState;
+    ConfigWatcher watcher;
 };
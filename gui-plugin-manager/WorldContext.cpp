@@ -0,0 +1,130 @@
+#include "WorldContext.h"
+#include "GUILogger.h"
+#include "PluginLib/ObjectIndex.h"
+#include "../plugin_manager_base/Plugin_Manager_Base_SDK/PluginAPI.h"
+#include "../plugin_manager_base/Plugin_Manager_Base_SDK/SDK/SDK.hpp"
+
+template <typename T>
+static T* ResolveAs(const ObjectArray::ObjectHandle& handle) {
+    return static_cast<T*>(ObjectArray::Resolve(handle));
+}
+
+SDK::UWorld* WorldContext::GetWorld() {
+    return SDK::UWorld::GetWorld();
+}
+
+SDK::UGameInstance* WorldContext::GetGameInstance() {
+    SDK::UWorld* world = SDK::UWorld::GetWorld();
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (!IsCurrentLocked(world) || !ObjectArray::Resolve(m_GameInstance)) {
+        ResolveLocked(world);
+    }
+    return ResolveAs<SDK::UGameInstance>(m_GameInstance);
+}
+
+SDK::APlayerController* WorldContext::GetPlayerController() {
+    SDK::UWorld* world = SDK::UWorld::GetWorld();
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (IsCurrentLocked(world)) {
+        if (SDK::APlayerController* pc = ResolveAs<SDK::APlayerController>(m_PlayerController)) {
+            return pc;
+        }
+    }
+    ResolveLocked(world);
+    return ResolveAs<SDK::APlayerController>(m_PlayerController);
+}
+
+SDK::APawn* WorldContext::GetPawn() {
+    SDK::APlayerController* pc = GetPlayerController();
+    if (!pc) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    // Without the hooks a possession change is invisible to the handle, so re-read the field
+    SDK::APawn* pawn = ResolveAs<SDK::APawn>(m_Pawn);
+    if (!pawn || !m_PawnValid.load(std::memory_order_acquire) || !m_HooksInstalled) {
+        ResolvePawnAndHUDLocked(pc);
+        pawn = ResolveAs<SDK::APawn>(m_Pawn);
+    }
+    return pawn;
+}
+
+SDK::AHUD* WorldContext::GetHUD() {
+    SDK::APlayerController* pc = GetPlayerController();
+    if (!pc) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    SDK::AHUD* hud = ResolveAs<SDK::AHUD>(m_HUD);
+    if (!hud || !m_PawnValid.load(std::memory_order_acquire) || !m_HooksInstalled) {
+        ResolvePawnAndHUDLocked(pc);
+        hud = ResolveAs<SDK::AHUD>(m_HUD);
+    }
+    return hud;
+}
+
+bool WorldContext::IsCurrentLocked(SDK::UWorld* world) {
+    return world && m_Valid.load(std::memory_order_acquire) && ObjectArray::Resolve(m_World) == world;
+}
+
+void WorldContext::ResolveLocked(SDK::UWorld* world) {
+    m_World = ObjectArray::MakeHandle(world);
+    m_GameInstance = {};
+    m_PlayerController = {};
+    m_Pawn = {};
+    m_HUD = {};
+
+    SDK::APlayerController* pc = nullptr;
+    if (world && world->OwningGameInstance) {
+        SDK::UGameInstance* gameInstance = world->OwningGameInstance;
+        m_GameInstance = ObjectArray::MakeHandle(gameInstance);
+        if (gameInstance->LocalPlayers.Num() > 0 && gameInstance->LocalPlayers[0]) {
+            pc = gameInstance->LocalPlayers[0]->PlayerController;
+        }
+    }
+
+    if (!pc) {
+        // Only visits player controllers, not every object in GObjects
+        SDK::UObject* obj = PluginAPI::ObjectIndex::Get().FindFirst(SDK::APlayerController::StaticClass(), [](SDK::UObject* candidate) {
+            return static_cast<SDK::APlayerController*>(candidate)->PlayerCameraManager != nullptr;
+        });
+        pc = static_cast<SDK::APlayerController*>(obj);
+    }
+
+    m_PlayerController = ObjectArray::MakeHandle(pc);
+    if (pc) {
+        InstallHooks(pc);
+        ResolvePawnAndHUDLocked(pc);
+    }
+
+    if ((pc != nullptr) != m_HadPlayerController) {
+        m_HadPlayerController = pc != nullptr;
+        GUILogger::Get().Log(pc ? "[INFO] [WorldContext] PlayerController found" : "[WARNING] [WorldContext] PlayerController lost");
+    }
+    m_Valid.store(world != nullptr, std::memory_order_release);
+}
+
+void WorldContext::ResolvePawnAndHUDLocked(SDK::APlayerController* pc) {
+    m_Pawn = ObjectArray::MakeHandle(pc->AcknowledgedPawn);
+    m_HUD = ObjectArray::MakeHandle(pc->MyHUD);
+    m_PawnValid.store(true, std::memory_order_release);
+}
+
+void WorldContext::InstallHooks(SDK::APlayerController* pc) {
+    // Hooks match the exact class name, so they follow the live controller's class
+    std::string className = pc->Class ? pc->Class->GetName() : std::string();
+    if (className.empty() || className == m_HookedClass) {
+        return;
+    }
+    m_HookedClass = className;  // one attempt per class, even if registration fails
+
+    // Post-callbacks: the new pawn / HUD is set once the RPC has run. The base copies the callback.
+    PluginAPI::PostHookCallback invalidatePawn = [this](void*, void*, void*) {
+        m_PawnValid.store(false, std::memory_order_release);
+    };
+    bool restartHooked = RegisterGlobalHook(className.c_str(), "ClientRestart", nullptr, &invalidatePawn);
+    bool hudHooked = RegisterGlobalHook(className.c_str(), "ClientSetHUD", nullptr, &invalidatePawn);
+    m_HooksInstalled = restartHooked && hudHooked;
+}
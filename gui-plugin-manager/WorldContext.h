@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <string>
+
+#include "../plugin_manager_base/Plugin_Manager_Base_SDK/ObjectArray.h"
+
+namespace SDK {
+    class UWorld;
+    class UGameInstance;
+    class APlayerController;
+    class APawn;
+    class AHUD;
+}
+
+// Cached World -> GameInstance -> PlayerController -> Pawn / HUD chain.
+// Each object is held as a weak handle (GObjects index + serial number), so a destroyed object
+// is never handed out. While GWorld is the world the chain was resolved in, a lookup is one
+// pointer compare plus a handle check; the chain is only walked again after a level change
+// (GWorld changes), a respawn or HUD swap (ClientRestart / ClientSetHUD hooks on the player
+// controller's class), or when a cached object is gone. It only logs when the player
+// controller is found or lost, not per call.
+class WorldContext {
+public:
+    static WorldContext& Get() {
+        static WorldContext instance;
+        return instance;
+    }
+
+    SDK::UWorld* GetWorld();
+    SDK::UGameInstance* GetGameInstance();
+    SDK::APlayerController* GetPlayerController();
+    SDK::APawn* GetPawn();
+    SDK::AHUD* GetHUD();
+
+    // Drop everything; the next lookup walks the chain again
+    void Invalidate() { m_Valid.store(false, std::memory_order_release); }
+
+private:
+    WorldContext() = default;
+    WorldContext(const WorldContext&) = delete;
+    WorldContext& operator=(const WorldContext&) = delete;
+
+    // m_Mutex held: true if the cached chain still belongs to the current world
+    bool IsCurrentLocked(SDK::UWorld* world);
+    // m_Mutex held: walk the chain from world (GObjects fallback for the player controller)
+    void ResolveLocked(SDK::UWorld* world);
+    // m_Mutex held: pawn and HUD from the cached player controller
+    void ResolvePawnAndHUDLocked(SDK::APlayerController* pc);
+    void InstallHooks(SDK::APlayerController* pc);
+
+    std::mutex m_Mutex;
+    ObjectArray::ObjectHandle m_World;
+    ObjectArray::ObjectHandle m_GameInstance;
+    ObjectArray::ObjectHandle m_PlayerController;
+    ObjectArray::ObjectHandle m_Pawn;
+    ObjectArray::ObjectHandle m_HUD;
+    std::atomic<bool> m_Valid{ false };
+    std::atomic<bool> m_PawnValid{ false };     // cleared by ClientRestart / ClientSetHUD
+    bool m_HooksInstalled = false;
+    std::string m_HookedClass;
+    bool m_HadPlayerController = false;         // for found/lost log lines
+};
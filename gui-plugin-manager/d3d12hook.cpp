@@ -1,5 +1,6 @@
 #include "stdafx.h"
 #include "PluginLib/HotkeyManager.h"
+#include "../plugin_manager_base/Plugin_Manager_Base_SDK/PluginAPI.h"   // IsStartupComplete
 
 namespace hooks { void Remove(); }
 
@@ -38,14 +39,14 @@ namespace d3d12hook {
     static bool                   gShutdown = false;
     static bool                   gAfterFirstPresent = false;
 
-    // F1 hotkey lock state
+    // F1 hotkey lock state: locked until the base reports startup complete, or at most
+    // F1_LOCK_MAX_MS after ImGui init (a stale SDK offset can keep the base probing for minutes)
     static auto initTime = std::chrono::high_resolution_clock::now();
-    static auto f1UnlockTime = std::chrono::high_resolution_clock::now() + std::chrono::seconds(5);
     static bool f1LockActive = true;
     static auto notificationStartTime = std::chrono::high_resolution_clock::now();
     static bool notificationActive = false;
-    static const int F1_LOCK_DURATION_MS = 5000;
     static const int NOTIFICATION_DISPLAY_DURATION_MS = 5000;
+    static const int F1_LOCK_MAX_MS = 30000;
 
     void release();
 
@@ -97,24 +98,28 @@ namespace d3d12hook {
     }
 
     long __fastcall hookPresentD3D12(IDXGISwapChain3* pSwapChain, UINT SyncInterval, UINT Flags) {
-        // Check if F1 lock period has expired
+        // Unlock F1 as soon as the base has finished starting up (checked until it has, then never again)
         auto now = std::chrono::high_resolution_clock::now();
-        if (f1LockActive && now >= f1UnlockTime) {
-            f1LockActive = false;
-            DebugLog("[d3d12hook] F1 hotkey unlocked.\n");
+        if (f1LockActive && gInitialized) {
+            bool timedOut = (now - initTime) >= std::chrono::milliseconds(F1_LOCK_MAX_MS);
+            if (IsStartupComplete() || timedOut) {
+                f1LockActive = false;
+                notificationActive = true;
+                notificationStartTime = now;
+                DebugLog("[d3d12hook] F1 hotkey unlocked %lld ms after ImGui init%s.\n",
+                    static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(now - initTime).count()),
+                    timedOut && !IsStartupComplete() ? " (base startup still running, unlocked anyway)" : "");
+            }
         }
 
-        // Check if notification should be displayed
-        if (notificationActive && (now - notificationStartTime) >= std::chrono::milliseconds(F1_LOCK_DURATION_MS)) {
-            notificationActive = true;  // Keep showing for 5 seconds from unlock
-        }
-        if (notificationActive && (now - notificationStartTime) >= std::chrono::milliseconds(F1_LOCK_DURATION_MS + NOTIFICATION_DISPLAY_DURATION_MS)) {
+        // The ready notification stays up for a few seconds after unlocking
+        if (notificationActive && (now - notificationStartTime) >= std::chrono::milliseconds(NOTIFICATION_DISPLAY_DURATION_MS)) {
             notificationActive = false;
             DebugLog("[d3d12hook] Plugin Loader Ready notification expired.\n");
         }
 
         // Create hotkey object
-        HotkeyManager::Hotkey menuKey(globals::openMenuKey, false, false, false);
+        HotkeyManager::Hotkey menuKey(Settings::Get().GetMenuHotkey(), false, false, false);
 
         // Edge detection for menu key to prevent stuttering
         static bool wasMenuKeyPressed = false;
@@ -136,12 +141,10 @@ namespace d3d12hook {
 
         if (!gInitialized) {
             DebugLog("[d3d12hook] Initializing ImGui on first Present.\n");
-            // Start F1 lock timer and notification
+            // F1 stays locked (and the ready notification hidden) until startup completes
             initTime = std::chrono::high_resolution_clock::now();
-            f1UnlockTime = initTime + std::chrono::milliseconds(F1_LOCK_DURATION_MS);
             f1LockActive = true;
-            notificationActive = true;
-            notificationStartTime = initTime;
+            notificationActive = false;
             DebugLog("[d3d12hook] ImGui initialized.\n");
             if (FAILED(pSwapChain->GetDevice(__uuidof(ID3D12Device), (void**)&gDevice))) {
                 LogHRESULT("GetDevice", E_FAIL);
@@ -362,7 +365,7 @@ namespace d3d12hook {
     }
 
     long __fastcall hookPresent1D3D12(IDXGISwapChain3* pSwapChain, UINT SyncInterval, UINT Flags, const DXGI_PRESENT_PARAMETERS* pParams) {
-        if (GetAsyncKeyState(globals::openMenuKey) & 1) {
+        if (GetAsyncKeyState(Settings::Get().GetMenuHotkey()) & 1) {
             menu::isOpen = !menu::isOpen;
             DebugLog("[d3d12hook] Toggle menu: isOpen=%d\n", (bool)menu::isOpen);
         }
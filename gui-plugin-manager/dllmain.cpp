@@ -103,8 +103,10 @@ static DWORD WINAPI onAttach(LPVOID lpParameter)
     GUILogger::Get().Initialize("Plugin_Manager/Plugin_Manager_GUI.log");
     globals::SetDebugLogging(true);
 
-    // Use F1 as default menu hotkey
-    globals::openMenuKey = VK_F1;
+    // Menu hotkey etc. come from plugin_manager_config.ini (F1 by default); edits apply live
+    Settings::Get().Load();
+    Settings::Get().StartWatching();
+    globals::openMenuKey = Settings::Get().GetMenuHotkey();
 
     DebugLog("[DllMain] onAttach starting.\n");
     DebugLog("[DllMain] Menu hotkey: VK 0x%X\n", globals::openMenuKey);
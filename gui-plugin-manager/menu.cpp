@@ -1,5 +1,6 @@
 #include "stdafx.h"
 #include "PluginManager.h"
+#include "MemoryReport.h"
 #include "PluginLib/PluginAPI.h"
 
 namespace menu {
@@ -8,6 +9,9 @@ namespace menu {
     static bool lastMenuState = false;
     static bool showDebugWindow = false;
     static bool showSettingsWindow = false;
+    static bool showMemoryReport = false;
+    static char logFilterText[256] = "";
+    static LogFilter logFilter;
 
     void Init() {
         bool isMenuOpen = isOpen.load(std::memory_order_relaxed);
@@ -41,13 +45,30 @@ namespace menu {
             if (ImGui::Button("Clear Log")) {
                 GUILogger::Get().ClearLogBuffer();
             }
+            ImGui::SameLine();
+            ImGui::SetNextItemWidth(-FLT_MIN);
+            ImGui::InputTextWithHint("##LogFilter", "Filter (all words must match)", logFilterText, sizeof(logFilterText));
+            logFilter.SetText(logFilterText);
 
             ImGui::Separator();
             ImGui::BeginChild("LogScrolling", ImVec2(0, 0), false, ImGuiWindowFlags_HorizontalScrollbar);
 
-            const auto& logBuffer = GUILogger::Get().GetLogBuffer();
-            for (const auto& entry : logBuffer) {
-                ImGui::TextUnformatted(("[" + entry.timestamp + "] " + entry.message).c_str());
+            {
+                // Only the visible rows are touched, so the cost per frame doesn't grow with the log.
+                // The filter only tests lines added since the last frame.
+                auto logView = GUILogger::Get().LockBuffer();
+                logFilter.Update(logView);
+                bool filtered = logFilter.IsActive();
+
+                ImGuiListClipper clipper;
+                clipper.Begin(static_cast<int>(filtered ? logFilter.Size() : logView.Size()));
+                while (clipper.Step()) {
+                    for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+                        std::string_view line = filtered ? logView.LineAt(logFilter.Sequence(i)) : logView.Line(i);
+                        ImGui::TextUnformatted(line.data(), line.data() + line.size());
+                    }
+                }
+                clipper.End();
             }
 
             if (ImGui::GetScrollY() >= ImGui::GetScrollMaxY()) {
@@ -58,6 +79,10 @@ namespace menu {
             ImGui::End();
         }
 
+        if (showMemoryReport) {
+            MemoryReport::Get().RenderWindow(&showMemoryReport);
+        }
+
         if (showSettingsWindow) {
             ImGui::SetNextWindowSize(ImVec2(500, 200), ImGuiCond_FirstUseEver);
             ImGui::Begin("Settings", &showSettingsWindow);
@@ -68,7 +93,8 @@ namespace menu {
 
             ImGui::Separator();
             ImGui::Text("Hotkeys:");
-            ImGui::Text("Menu Toggle: F1 (hardcoded)");
+            ImGui::Text("Menu Toggle: %s (MenuHotkey in plugin_manager_config.ini)",
+                Settings::Get().VirtualKeyToString(Settings::Get().GetMenuHotkey()).c_str());
 
             ImGui::End();
         }
@@ -105,6 +131,9 @@ namespace menu {
                 if (ImGui::MenuItem("Settings", nullptr, showSettingsWindow)) {
                     showSettingsWindow = !showSettingsWindow;
                 }
+                if (ImGui::MenuItem("Memory Report", nullptr, showMemoryReport)) {
+                    showMemoryReport = !showMemoryReport;
+                }
                 ImGui::EndMenu();
             }
             ImGui::EndMenuBar();
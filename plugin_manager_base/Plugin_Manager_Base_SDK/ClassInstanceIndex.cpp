@@ -0,0 +1,244 @@
+#include "ClassInstanceIndex.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace
+{
+	int32_t PartitionOf(const SDK::UClass* Class, int32_t Partitions)
+	{
+		return static_cast<int32_t>((reinterpret_cast<uintptr_t>(Class) >> 4) % static_cast<uintptr_t>(Partitions));
+	}
+
+	// Work(Begin, End) over [0, Count) split into one contiguous range per thread
+	template <typename WorkFn>
+	void RunParallel(int Threads, int32_t Count, WorkFn&& Work)
+	{
+		Threads = (std::min)(Threads, static_cast<int>(Count));
+		if (Threads <= 1)
+		{
+			Work(0, Count);
+			return;
+		}
+
+		std::vector<std::thread> Workers;
+		const int32_t Step = (Count + Threads - 1) / Threads;
+		for (int t = 0; t < Threads; ++t)
+		{
+			const int32_t Begin = t * Step;
+			const int32_t End = (std::min)(Count, Begin + Step);
+			if (Begin < End)
+				Workers.emplace_back([&Work, Begin, End]() { Work(Begin, End); });
+		}
+		for (std::thread& Worker : Workers)
+			Worker.join();
+	}
+}
+
+void ClassInstanceIndex::Build(int Threads)
+{
+	std::lock_guard<std::mutex> RefreshLock(RefreshMutex);
+	BuildLocked(Threads);
+}
+
+void ClassInstanceIndex::Refresh()
+{
+	std::lock_guard<std::mutex> RefreshLock(RefreshMutex);
+	if (!bBuilt.load(std::memory_order_acquire))
+	{
+		BuildLocked(0);
+		return;
+	}
+
+	std::vector<std::pair<int32_t, Slot>> Changes;
+	Mirror.Update([&](int32_t Index, const SDK::FUObjectItem* Item) {
+		Slot Changed;
+		if (Item && Item->Object)
+		{
+			Changed.Object = Item->Object;
+			Changed.Class = Item->Object->Class;
+		}
+		Changes.emplace_back(Index, Changed);
+	});
+	if (Changes.empty())
+		return;
+
+	std::unique_lock<std::shared_mutex> Lock(Mutex);
+	if (static_cast<int32_t>(Slots.size()) < Mirror.Size())
+		Slots.resize(Mirror.Size());
+	for (auto& [Index, Changed] : Changes)
+	{
+		RemoveLocked(Index);
+		InsertLocked(Index, Changed);
+	}
+}
+
+void ClassInstanceIndex::StartAutoRefresh(uint32_t IntervalMs)
+{
+	Refresher.Start([this]() { Refresh(); }, IntervalMs);
+}
+
+void ClassInstanceIndex::StopAutoRefresh()
+{
+	Refresher.Stop();
+}
+
+void ClassInstanceIndex::GetInstances(const SDK::UClass* Class, bool bExactClassOnly, std::vector<SDK::UObject*>& Out)
+{
+	if (!Class)
+		return;
+	EnsureBuilt();
+
+	std::vector<const SDK::UClass*> Matching;
+	if (bExactClassOnly)
+		Matching.push_back(Class);
+	else
+		Matching = GetSubclasses(Class);
+
+	std::shared_lock<std::shared_mutex> Lock(Mutex);
+	for (const SDK::UClass* Candidate : Matching)
+	{
+		auto It = Classes.find(Candidate);
+		if (It == Classes.end())
+			continue;
+
+		for (int32_t Index : It->second)
+		{
+			// The slot may have changed since the last refresh
+			const SDK::FUObjectItem* Item = ObjectArray::GetItem(Index);
+			if (Item && Item->Object == Slots[Index].Object)
+				Out.push_back(Item->Object);
+		}
+	}
+}
+
+void ClassInstanceIndex::GetClasses(std::vector<const SDK::UClass*>& Out)
+{
+	EnsureBuilt();
+
+	std::shared_lock<std::shared_mutex> Lock(Mutex);
+	Out.reserve(Out.size() + Classes.size());
+	for (const auto& [Class, Instances] : Classes)
+		Out.push_back(Class);
+}
+
+void ClassInstanceIndex::EnsureBuilt()
+{
+	// Builds once; concurrent callers wait for that build instead of repeating it
+	if (!bBuilt.load(std::memory_order_acquire))
+		Refresh();
+}
+
+// RefreshMutex held
+void ClassInstanceIndex::BuildLocked(int Threads)
+{
+	const int32_t Count = ObjectArray::Num();
+	if (Count <= 0)
+		return;
+	if (Threads <= 0)
+		Threads = (std::max)(1, static_cast<int>(std::thread::hardware_concurrency()) / 2);
+
+	// Pass 1: read every slot (disjoint ranges, no sharing)
+	std::vector<Slot> NewSlots(Count);
+	std::vector<uint64_t> Fingerprints(Count, 0);
+	RunParallel(Threads, Count, [&](int32_t Begin, int32_t End) {
+		for (int32_t i = Begin; i < End; ++i)
+		{
+			const SDK::FUObjectItem* Item = ObjectArray::GetItem(i);
+			if (!Item || !Item->Object)
+				continue;
+			NewSlots[i].Object = Item->Object;
+			NewSlots[i].Class = Item->Object->Class;
+			Fingerprints[i] = ObjectArray::NamedFingerprint(Item);
+		}
+	});
+
+	// Pass 2: group by class, each worker owning the classes that hash to it
+	std::vector<ClassMap> Partitions(Threads);
+	RunParallel(Threads, Threads, [&](int32_t Begin, int32_t End) {
+		for (int32_t p = Begin; p < End; ++p)
+		{
+			for (int32_t i = 0; i < Count; ++i)
+			{
+				Slot& Current = NewSlots[i];
+				if (Current.Class && PartitionOf(Current.Class, Threads) == p)
+				{
+					std::vector<int32_t>& List = Partitions[p][Current.Class];
+					Current.Position = static_cast<int32_t>(List.size());
+					List.push_back(i);
+				}
+			}
+		}
+	});
+
+	ClassMap NewClasses;
+	for (ClassMap& Partition : Partitions)
+		NewClasses.merge(Partition);
+
+	Mirror.Assign(std::move(Fingerprints));
+
+	std::unique_lock<std::shared_mutex> Lock(Mutex);
+	Slots = std::move(NewSlots);
+	Classes = std::move(NewClasses);
+	SubclassCache.clear();
+	bBuilt.store(true, std::memory_order_release);
+}
+
+// Swap-remove the slot's entry from its class list (exclusive lock held)
+void ClassInstanceIndex::RemoveLocked(int32_t Index)
+{
+	Slot& Current = Slots[Index];
+	if (Current.Class)
+	{
+		auto It = Classes.find(Current.Class);
+		if (It != Classes.end())
+		{
+			std::vector<int32_t>& List = It->second;
+			const int32_t Moved = List.back();
+			List[Current.Position] = Moved;
+			Slots[Moved].Position = Current.Position;
+			List.pop_back();
+
+			// Drop classes without instances: an unloaded class must never be dereferenced.
+			// Cached subclass lists may still name it, but lookups go through Classes.
+			if (List.empty())
+				Classes.erase(It);
+		}
+	}
+	Current = Slot();
+}
+
+// Exclusive lock held
+void ClassInstanceIndex::InsertLocked(int32_t Index, const Slot& NewSlot)
+{
+	Slots[Index] = NewSlot;
+	if (!NewSlot.Class)
+		return;
+
+	auto [It, bInserted] = Classes.try_emplace(NewSlot.Class);
+	if (bInserted)
+		SubclassCache.clear();      // a class we haven't seen may extend a cached query
+	Slots[Index].Position = static_cast<int32_t>(It->second.size());
+	It->second.push_back(Index);
+}
+
+// All indexed classes that are Class or derive from it (cached per query class)
+std::vector<const SDK::UClass*> ClassInstanceIndex::GetSubclasses(const SDK::UClass* Class)
+{
+	{
+		std::shared_lock<std::shared_mutex> Lock(Mutex);
+		auto It = SubclassCache.find(Class);
+		if (It != SubclassCache.end())
+			return It->second;
+	}
+
+	std::unique_lock<std::shared_mutex> Lock(Mutex);
+	std::vector<const SDK::UClass*> Subclasses;
+	for (const auto& [Candidate, Instances] : Classes)
+	{
+		if (Candidate->IsSubclassOf(Class))
+			Subclasses.push_back(Candidate);
+	}
+	SubclassCache[Class] = Subclasses;
+	return Subclasses;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "ObjectSlotMirror.h"
+
+/**
+* Class -> live instances index over GObjects
+* Built once in parallel, then kept current by ObjectSlotMirror passes: only slots that changed
+* touch the index, and nothing calls IsA. "All instances of X" is then proportional to the
+* number of instances (plus the number of distinct classes on the first query for X), not to
+* the size of GObjects.
+*
+* One instance per process, owned by this DLL: the GUI and every plugin query it through the
+* exports in PluginAPI.h (PluginAPI::ObjectIndex wraps them), so a refresh started by anyone
+* serves everyone. Results are copied out under the lock and re-validated against their slot,
+* so callers never run code under the lock and never get an object destroyed since the last
+* refresh; one created since then shows up after the next.
+*/
+
+class ClassInstanceIndex
+{
+public:
+	static ClassInstanceIndex& Get()
+	{
+		static ClassInstanceIndex Instance;
+		return Instance;
+	}
+
+	// Full rebuild, split across worker threads (0 = half the hardware threads)
+	void Build(int Threads = 0);
+
+	// Apply everything that changed in GObjects since the last Build/Refresh (builds first if needed)
+	void Refresh();
+
+	// Refresh on a background thread every IntervalMs; StopAutoRefresh joins that thread
+	void StartAutoRefresh(uint32_t IntervalMs = 2000);
+	void StopAutoRefresh();
+
+	bool IsBuilt() const { return bBuilt.load(std::memory_order_acquire); }
+
+	// Appends the live instances of Class (and its subclasses unless bExactClassOnly) to Out
+	void GetInstances(const SDK::UClass* Class, bool bExactClassOnly, std::vector<SDK::UObject*>& Out);
+
+	// Appends every class with at least one indexed instance to Out
+	void GetClasses(std::vector<const SDK::UClass*>& Out);
+
+private:
+	struct Slot
+	{
+		SDK::UObject* Object = nullptr;
+		const SDK::UClass* Class = nullptr;
+		int32_t Position = -1;      // index in Classes[Class]
+	};
+
+	using ClassMap = std::unordered_map<const SDK::UClass*, std::vector<int32_t>>;
+
+	ClassInstanceIndex() : Refresher("ClassInstanceIndex") {}
+	ClassInstanceIndex(const ClassInstanceIndex&) = delete;
+	ClassInstanceIndex& operator=(const ClassInstanceIndex&) = delete;
+
+	void EnsureBuilt();
+	void BuildLocked(int Threads);
+	void RemoveLocked(int32_t Index);
+	void InsertLocked(int32_t Index, const Slot& NewSlot);
+	std::vector<const SDK::UClass*> GetSubclasses(const SDK::UClass* Class);
+
+	std::vector<Slot> Slots;
+	ClassMap Classes;
+	std::unordered_map<const SDK::UClass*, std::vector<const SDK::UClass*>> SubclassCache;
+	mutable std::shared_mutex Mutex;        // guards the three containers above
+	std::mutex RefreshMutex;                // one Build/Refresh at a time; guards Mirror
+	ObjectSlotMirror Mirror;
+	RefreshThread Refresher;
+	std::atomic<bool> bBuilt{ false };
+};
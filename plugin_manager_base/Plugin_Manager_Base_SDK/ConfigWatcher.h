@@ -0,0 +1,161 @@
+#pragma once
+
+#include <Windows.h>
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+* Hot-reloadable configuration
+* AtomicConfig<T> publishes immutable config snapshots through one atomic shared_ptr, so hot
+* paths read the current config with a single load and no lock. A reader keeps the snapshot
+* it loaded alive for as long as it holds the pointer (one call, typically); a replaced
+* snapshot is freed when its last reader lets go of it. ConfigWatcher runs a callback
+* whenever a file's last-write time changes (directory change notification, debounced),
+* which is where a new snapshot gets parsed and published.
+*/
+
+template <typename T>
+class AtomicConfig
+{
+public:
+	AtomicConfig() { Publish(std::make_unique<T>()); }
+
+	// Current snapshot; load it once per call and pass it on, rather than calling Get() again
+	std::shared_ptr<const T> Get() const { return Current.load(std::memory_order_acquire); }
+
+	// Make Next the current snapshot. Readers still holding the previous one keep it until they return.
+	void Publish(std::unique_ptr<T> Next)
+	{
+		Current.store(std::shared_ptr<const T>(std::move(Next)), std::memory_order_release);
+	}
+
+private:
+	std::atomic<std::shared_ptr<const T>> Current;
+};
+
+class ConfigWatcher
+{
+public:
+	ConfigWatcher() = default;
+	~ConfigWatcher() { Stop(); }
+
+	ConfigWatcher(const ConfigWatcher&) = delete;
+	ConfigWatcher& operator=(const ConfigWatcher&) = delete;
+
+	// Watch FilePath and call OnChange (on the watcher thread) after it was modified
+	bool Start(const std::string& FilePath, std::function<void()> OnChange, DWORD DebounceMs = 250)
+	{
+		Stop();
+
+		auto NewState = std::make_shared<State>();
+		NewState->FilePath = FilePath;
+		NewState->OnChange = std::move(OnChange);
+		NewState->DebounceMs = DebounceMs;
+		NewState->LastWrite = GetLastWriteTime(FilePath);
+		NewState->StopEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+		if (!NewState->StopEvent)
+			return false;
+
+		// Detached like our other background threads; it owns a reference to its state and
+		// exits on its own once the stop event is set
+		std::thread(&ConfigWatcher::WatchLoop, NewState).detach();
+		Active = std::move(NewState);
+		return true;
+	}
+
+	// Signal the watcher thread to exit (does not wait for it)
+	void Stop()
+	{
+		if (Active)
+		{
+			SetEvent(Active->StopEvent);
+			Active.reset();
+		}
+	}
+
+private:
+	struct State
+	{
+		std::string FilePath;
+		std::function<void()> OnChange;
+		DWORD DebounceMs = 250;
+		ULONGLONG LastWrite = 0;
+		HANDLE StopEvent = nullptr;
+
+		~State()
+		{
+			if (StopEvent)
+				CloseHandle(StopEvent);
+		}
+	};
+
+	static ULONGLONG GetLastWriteTime(const std::string& FilePath)
+	{
+		WIN32_FILE_ATTRIBUTE_DATA Data;
+		if (!GetFileAttributesExA(FilePath.c_str(), GetFileExInfoStandard, &Data))
+			return 0;
+		return (static_cast<ULONGLONG>(Data.ftLastWriteTime.dwHighDateTime) << 32) | Data.ftLastWriteTime.dwLowDateTime;
+	}
+
+	static void WatchLoop(std::shared_ptr<State> Watch)
+	{
+		std::filesystem::path Directory = std::filesystem::path(Watch->FilePath).parent_path();
+		if (Directory.empty())
+			Directory = ".";
+
+		// Notifications cover the whole directory, the write time check narrows it to our file.
+		// If the directory can't be watched, fall back to polling once per second.
+		HANDLE Change = FindFirstChangeNotificationA(Directory.string().c_str(), FALSE,
+			FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_SIZE);
+		if (Change == INVALID_HANDLE_VALUE)
+		{
+			OutputDebugStringA("ConfigWatcher: FindFirstChangeNotification failed, polling instead.\n");
+			Change = nullptr;
+		}
+
+		while (true)
+		{
+			if (Change)
+			{
+				HANDLE Handles[2] = { Watch->StopEvent, Change };
+				DWORD Result = WaitForMultipleObjects(2, Handles, FALSE, INFINITE);
+				if (Result != WAIT_OBJECT_0 + 1)
+					break;
+				FindNextChangeNotification(Change);
+
+				// Editors save in several steps; let them finish before reading
+				if (WaitForSingleObject(Watch->StopEvent, Watch->DebounceMs) == WAIT_OBJECT_0)
+					break;
+			}
+			else if (WaitForSingleObject(Watch->StopEvent, 1000) == WAIT_OBJECT_0)
+			{
+				break;
+			}
+
+			ULONGLONG LastWrite = GetLastWriteTime(Watch->FilePath);
+			if (LastWrite == 0 || LastWrite == Watch->LastWrite)
+				continue;
+			Watch->LastWrite = LastWrite;
+
+			try
+			{
+				Watch->OnChange();
+			}
+			catch (...)
+			{
+				OutputDebugStringA("ConfigWatcher: Exception in change callback\n");
+			}
+		}
+
+		if (Change)
+			FindCloseChangeNotification(Change);
+	}
+
+	std::shared_ptr<State> Active;
+};
@@ -3,6 +3,9 @@
 #include "SDK/SDK/CoreUObject_classes.hpp"
 #include "SDK/SDK/Engine_classes.hpp"
 #include "MinHook.h"
+#include "LogFormat.h"
+#include <algorithm>
+#include <iterator>
 #include <iostream>
 #include <sstream>
 
@@ -17,19 +20,28 @@ static ProcessEventFnType g_OriginalProcessEvent = nullptr;
 // ===== Logging =====
 // Note: std::cout is disabled - logging only goes to OutputDebugString for debugging
 
-void HookSystem::LogInfo(const std::string& msg) {
-    std::string fullMsg = "[HookSystem] " + msg + "\n";
-    OutputDebugStringA(fullMsg.c_str());
+void HookSystem::LogInfo(std::string_view msg) {
+    LogFormat::FixedBuffer<2048> line;
+    line.Append("[HookSystem] ");
+    line.Append(msg);
+    line.TerminateLine();
+    OutputDebugStringA(line.CStr());
 }
 
-void HookSystem::LogWarning(const std::string& msg) {
-    std::string fullMsg = "[HookSystem WARNING] " + msg + "\n";
-    OutputDebugStringA(fullMsg.c_str());
+void HookSystem::LogWarning(std::string_view msg) {
+    LogFormat::FixedBuffer<2048> line;
+    line.Append("[HookSystem WARNING] ");
+    line.Append(msg);
+    line.TerminateLine();
+    OutputDebugStringA(line.CStr());
 }
 
-void HookSystem::LogError(const std::string& msg) {
-    std::string fullMsg = "[HookSystem ERROR] " + msg + "\n";
-    OutputDebugStringA(fullMsg.c_str());
+void HookSystem::LogError(std::string_view msg) {
+    LogFormat::FixedBuffer<2048> line;
+    line.Append("[HookSystem ERROR] ");
+    line.Append(msg);
+    line.TerminateLine();
+    OutputDebugStringA(line.CStr());
 }
 
 // ===== ProcessEvent Hook Wrapper =====
@@ -218,8 +230,16 @@ bool HookSystem::RegisterHook(
     PostHookCallback PostCallback,
     bool bSilent)
 {
-    std::lock_guard<std::mutex> lock(m_HooksMutex);
+    return RegisterHookWithHandle(ClassName, FunctionName, PreCallback, PostCallback, bSilent) != 0;
+}
 
+uint64_t HookSystem::RegisterHookWithHandle(
+    const std::string& ClassName,
+    const std::string& FunctionName,
+    PreHookCallback PreCallback,
+    PostHookCallback PostCallback,
+    bool bSilent)
+{
     // DEBUG: Log callback status and instance address
     if (!bSilent) {
         std::stringstream ss;
@@ -235,7 +255,7 @@ bool HookSystem::RegisterHook(
     {
         if (!bSilent)
             LogError("ClassName or FunctionName is empty");
-        return false;
+        return 0;
     }
 
     if (!bSilent)
@@ -247,7 +267,7 @@ bool HookSystem::RegisterHook(
     {
         if (!bSilent)
             LogError("Class not found: " + ClassName);
-        return false;
+        return 0;
     }
 
     if (!bSilent)
@@ -259,7 +279,7 @@ bool HookSystem::RegisterHook(
     {
         if (!bSilent)
             LogError("Function not found: " + FunctionName);
-        return false;
+        return 0;
     }
 
     if (!bSilent) {
@@ -268,18 +288,22 @@ bool HookSystem::RegisterHook(
         LogInfo("  Function GetName() returns: " + ActualFunctionName);
     }
 
+    // Validation above scans GObjects, so it runs without the lock every ProcessEvent takes
+    std::lock_guard<std::mutex> lock(m_HooksMutex);
+
     // Add callbacks to the nested dictionary (pure dictionary system)
     int preCallbackCount = 0;
     int postCallbackCount = 0;
+    const uint64_t Handle = m_NextHandle++;
 
     if (PreCallback) {
         // Debug logging removed - too verbose. Use debugger or OutputDebugString if needed.
-        m_PreCallbacksByClass[ClassName][FunctionName].push_back(PreCallback);
+        m_PreCallbacksByClass[ClassName][FunctionName].push_back({ Handle, PreCallback });
         preCallbackCount = m_PreCallbacksByClass[ClassName][FunctionName].size();
     }
 
     if (PostCallback) {
-        m_PostCallbacksByClass[ClassName][FunctionName].push_back(PostCallback);
+        m_PostCallbacksByClass[ClassName][FunctionName].push_back({ Handle, PostCallback });
         postCallbackCount = m_PostCallbacksByClass[ClassName][FunctionName].size();
     }
 
@@ -293,7 +317,7 @@ bool HookSystem::RegisterHook(
 
     if (!bSilent)
         LogInfo("Hook registered successfully: " + ClassName + "::" + FunctionName);
-    return true;
+    return Handle;
 }
 
 bool HookSystem::RegisterHook(
@@ -386,6 +410,46 @@ bool HookSystem::UnregisterHook(void* Object, const std::string& FunctionName)
     return UnregisterHook(ClassName, FunctionName);
 }
 
+namespace {
+
+// Erases the callbacks registered under Handle, dropping function/class entries left empty
+template <typename CallbackMap>
+bool EraseHandle(CallbackMap& CallbacksByClass, uint64_t Handle)
+{
+    bool bFound = false;
+    for (auto classIt = CallbacksByClass.begin(); classIt != CallbacksByClass.end();) {
+        for (auto funcIt = classIt->second.begin(); funcIt != classIt->second.end();) {
+            auto& Callbacks = funcIt->second;
+            const size_t Before = Callbacks.size();
+            Callbacks.erase(std::remove_if(Callbacks.begin(), Callbacks.end(),
+                [Handle](const auto& Registered) { return Registered.Handle == Handle; }), Callbacks.end());
+            bFound |= Callbacks.size() != Before;
+            funcIt = Callbacks.empty() ? classIt->second.erase(funcIt) : std::next(funcIt);
+        }
+        classIt = classIt->second.empty() ? CallbacksByClass.erase(classIt) : std::next(classIt);
+    }
+    return bFound;
+}
+
+}  // namespace
+
+bool HookSystem::UnregisterHookHandle(uint64_t Handle)
+{
+    if (Handle == 0)
+        return false;
+
+    std::lock_guard<std::mutex> lock(m_HooksMutex);
+
+    // Callbacks already copied out by a ProcessEvent in flight still run once more
+    const bool bPreFound = EraseHandle(m_PreCallbacksByClass, Handle);
+    const bool bPostFound = EraseHandle(m_PostCallbacksByClass, Handle);
+    if (!bPreFound && !bPostFound) {
+        LogWarning("Hook handle not found: " + std::to_string(Handle));
+        return false;
+    }
+    return true;
+}
+
 std::vector<PreHookCallback> HookSystem::GetPreCallbacksByClass(const std::string& ClassName, const std::string& FunctionName) const
 {
     std::lock_guard<std::mutex> lock(m_HooksMutex);
@@ -397,7 +461,11 @@ std::vector<PreHookCallback> HookSystem::GetPreCallbacksByClass(const std::strin
         auto funcIt = classIt->second.find(FunctionName);
         if (funcIt != classIt->second.end())
         {
-            return funcIt->second;
+            std::vector<PreHookCallback> Callbacks;
+            Callbacks.reserve(funcIt->second.size());
+            for (const auto& Registered : funcIt->second)
+                Callbacks.push_back(Registered.Function);
+            return Callbacks;
         }
     }
 
@@ -414,7 +482,11 @@ std::vector<PostHookCallback> HookSystem::GetPostCallbacksByClass(const std::str
         auto funcIt = classIt->second.find(FunctionName);
         if (funcIt != classIt->second.end())
         {
-            return funcIt->second;
+            std::vector<PostHookCallback> Callbacks;
+            Callbacks.reserve(funcIt->second.size());
+            for (const auto& Registered : funcIt->second)
+                Callbacks.push_back(Registered.Function);
+            return Callbacks;
         }
     }
 
@@ -1,6 +1,8 @@
 #pragma once
+#include <cstdint>
 #include <functional>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
 #include <mutex>
@@ -36,7 +38,18 @@ public:
         PostHookCallback PostCallback = nullptr
     );
 
+    // Same as RegisterHook, but returns a handle for UnregisterHookHandle (0 on failure)
+    uint64_t RegisterHookWithHandle(
+        const std::string& ClassName,
+        const std::string& FunctionName,
+        PreHookCallback PreCallback = nullptr,
+        PostHookCallback PostCallback = nullptr,
+        bool bSilent = false
+    );
+
     bool UnregisterHook(const std::string& ClassName, const std::string& FunctionName);
+    // Removes only the callbacks registered under Handle; other hooks on the same function stay
+    bool UnregisterHookHandle(uint64_t Handle);
     bool UnregisterHook(void* Object, const std::string& FunctionName);
     bool InitializeProcessEventHook();
     std::vector<PreHookCallback> GetPreCallbacksByClass(const std::string& ClassName, const std::string& FunctionName) const;
@@ -45,9 +58,9 @@ public:
     void RegisterGlobalPostCallback(PostHookCallback Callback);
     std::vector<PreHookCallback> GetGlobalPreCallbacks() const;
     std::vector<PostHookCallback> GetGlobalPostCallbacks() const;
-    static void LogInfo(const std::string& msg);
-    static void LogWarning(const std::string& msg);
-    static void LogError(const std::string& msg);
+    static void LogInfo(std::string_view msg);
+    static void LogWarning(std::string_view msg);
+    static void LogError(std::string_view msg);
 
 private:
     HookSystem() = default;
@@ -56,8 +69,15 @@ private:
     HookSystem(const HookSystem&) = delete;
     HookSystem& operator=(const HookSystem&) = delete;
 
-    std::map<std::string, std::map<std::string, std::vector<PreHookCallback>>> m_PreCallbacksByClass;
-    std::map<std::string, std::map<std::string, std::vector<PostHookCallback>>> m_PostCallbacksByClass;
+    template <typename Callback>
+    struct RegisteredCallback {
+        uint64_t Handle;
+        Callback Function;
+    };
+
+    std::map<std::string, std::map<std::string, std::vector<RegisteredCallback<PreHookCallback>>>> m_PreCallbacksByClass;
+    std::map<std::string, std::map<std::string, std::vector<RegisteredCallback<PostHookCallback>>>> m_PostCallbacksByClass;
+    uint64_t m_NextHandle = 1;
     mutable std::mutex m_HooksMutex;
     std::vector<PreHookCallback> m_GlobalPreCallbacks;
     std::vector<PostHookCallback> m_GlobalPostCallbacks;
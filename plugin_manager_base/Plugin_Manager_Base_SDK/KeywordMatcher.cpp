@@ -0,0 +1,123 @@
+#include "KeywordMatcher.h"
+
+#include <cctype>
+#include <queue>
+
+namespace
+{
+	inline uint8_t FoldCase(unsigned char C)
+	{
+		return static_cast<uint8_t>(std::tolower(C));
+	}
+}
+
+void KeywordMatcher::Build(const std::vector<std::string>& Keywords)
+{
+	SymbolOf.fill(0);
+	NumSymbols = 1;
+	Transitions.clear();
+	Accepting.clear();
+	bEmpty = true;
+
+	// Assign a symbol to every distinct (lowercased) keyword byte; upper and lower case
+	// map to the same symbol so matching never has to fold the input
+	for (const auto& Keyword : Keywords)
+	{
+		for (unsigned char C : Keyword)
+		{
+			uint8_t Lower = FoldCase(C);
+			if (SymbolOf[Lower] == 0)
+			{
+				SymbolOf[Lower] = static_cast<uint8_t>(NumSymbols++);
+			}
+		}
+	}
+	for (int C = 0; C < 256; ++C)
+	{
+		SymbolOf[C] = SymbolOf[FoldCase(static_cast<unsigned char>(C))];
+	}
+
+	// Build the trie, 0 is the root and also means "no edge" while building
+	Transitions.assign(NumSymbols, 0);
+	Accepting.assign(1, 0);
+
+	for (const auto& Keyword : Keywords)
+	{
+		if (Keyword.empty())
+			continue;
+
+		uint32_t State = 0;
+		for (unsigned char C : Keyword)
+		{
+			uint32_t Symbol = SymbolOf[C];
+			uint32_t Next = Transitions[State * NumSymbols + Symbol];
+			if (Next == 0)
+			{
+				Next = static_cast<uint32_t>(Accepting.size());
+				Accepting.push_back(0);
+				Transitions.resize(Transitions.size() + NumSymbols, 0);
+				Transitions[State * NumSymbols + Symbol] = Next;
+			}
+			State = Next;
+		}
+		Accepting[State] = 1;
+		bEmpty = false;
+	}
+
+	// Breadth-first pass computes fail links and turns the trie into a full DFA:
+	// missing edges borrow the transition of the fail state
+	std::vector<uint32_t> Fail(Accepting.size(), 0);
+	std::queue<uint32_t> Pending;
+
+	for (uint32_t Symbol = 1; Symbol < NumSymbols; ++Symbol)
+	{
+		uint32_t Child = Transitions[Symbol];
+		if (Child != 0)
+		{
+			Fail[Child] = 0;
+			Pending.push(Child);
+		}
+	}
+
+	while (!Pending.empty())
+	{
+		uint32_t State = Pending.front();
+		Pending.pop();
+
+		Accepting[State] |= Accepting[Fail[State]];
+
+		for (uint32_t Symbol = 0; Symbol < NumSymbols; ++Symbol)
+		{
+			uint32_t& Edge = Transitions[State * NumSymbols + Symbol];
+			uint32_t FailEdge = Transitions[Fail[State] * NumSymbols + Symbol];
+			if (Edge != 0 && Symbol != 0)
+			{
+				Fail[Edge] = FailEdge;
+				Pending.push(Edge);
+			}
+			else
+			{
+				Edge = FailEdge;
+			}
+		}
+	}
+}
+
+bool KeywordMatcher::Matches(std::string_view Text) const
+{
+	if (bEmpty)
+		return false;
+
+	const uint32_t* Table = Transitions.data();
+	const uint8_t* Accept = Accepting.data();
+
+	uint32_t State = 0;
+	for (unsigned char C : Text)
+	{
+		State = Table[State * NumSymbols + SymbolOf[C]];
+		if (Accept[State])
+			return true;
+	}
+
+	return false;
+}
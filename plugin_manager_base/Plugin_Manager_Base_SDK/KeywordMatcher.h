@@ -0,0 +1,43 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+* Case-insensitive multi-keyword matcher
+* Compiles the [Logging] Keywords list into an Aho-Corasick automaton once at config
+* load, so a single left-to-right pass over a function name answers "does any keyword
+* occur in it" without lowercasing copies or per-keyword searches.
+*/
+
+class KeywordMatcher
+{
+public:
+	KeywordMatcher() = default;
+
+	// Rebuild the automaton from a keyword list (empty keywords are ignored)
+	void Build(const std::vector<std::string>& Keywords);
+
+	// True if any keyword occurs in Text (ASCII case-insensitive)
+	bool Matches(std::string_view Text) const;
+
+	// True if no keywords were compiled
+	bool IsEmpty() const { return bEmpty; }
+
+private:
+	// Bytes that never appear in a keyword all fold into symbol 0, which keeps the
+	// transition table at (nodes x distinct keyword bytes) instead of (nodes x 256)
+	std::array<uint8_t, 256> SymbolOf{};
+	uint32_t NumSymbols = 1;
+
+	// Dense goto table (fail links already folded in), indexed [State * NumSymbols + Symbol]
+	std::vector<uint32_t> Transitions;
+
+	// Per-state flag: a keyword ends here or at any state on its fail chain
+	std::vector<uint8_t> Accepting;
+
+	bool bEmpty = true;
+};
@@ -0,0 +1,244 @@
+#include "LogCompression.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+	constexpr size_t MinMatch = 4;
+	constexpr size_t MaxOffset = 0xFFFF;
+	constexpr int HashBits = 14;
+
+	inline uint32_t Read32(const uint8_t* P)
+	{
+		uint32_t V;
+		std::memcpy(&V, P, sizeof(V));
+		return V;
+	}
+
+	inline uint32_t HashSequence(uint32_t Sequence)
+	{
+		return (Sequence * 2654435761u) >> (32 - HashBits);
+	}
+
+	inline void WriteLength(std::vector<uint8_t>& Out, size_t Extra)
+	{
+		while (Extra >= 255)
+		{
+			Out.push_back(255);
+			Extra -= 255;
+		}
+		Out.push_back(static_cast<uint8_t>(Extra));
+	}
+
+	inline bool ReadLength(const uint8_t* Src, size_t SrcSize, size_t& Pos, size_t& Length)
+	{
+		uint8_t Byte;
+		do
+		{
+			if (Pos >= SrcSize)
+				return false;
+			Byte = Src[Pos++];
+			Length += Byte;
+		} while (Byte == 255);
+		return true;
+	}
+
+	void EmitSequence(std::vector<uint8_t>& Out, const uint8_t* Literals, size_t LiteralLength, size_t Offset, size_t MatchLength)
+	{
+		size_t MatchCode = MatchLength ? MatchLength - MinMatch : 0;
+		uint8_t Token = static_cast<uint8_t>((LiteralLength >= 15 ? 15 : LiteralLength) << 4);
+		Token |= static_cast<uint8_t>(MatchCode >= 15 ? 15 : MatchCode);
+		Out.push_back(Token);
+
+		if (LiteralLength >= 15)
+			WriteLength(Out, LiteralLength - 15);
+		Out.insert(Out.end(), Literals, Literals + LiteralLength);
+
+		if (MatchLength == 0)
+			return;
+
+		Out.push_back(static_cast<uint8_t>(Offset & 0xFF));
+		Out.push_back(static_cast<uint8_t>(Offset >> 8));
+		if (MatchCode >= 15)
+			WriteLength(Out, MatchCode - 15);
+	}
+}
+
+namespace LogCompression
+{
+	size_t CompressBlock(const uint8_t* Src, size_t SrcSize, std::vector<uint8_t>& Out)
+	{
+		const size_t Start = Out.size();
+
+		// Table holds position + 1 so zero means "empty"
+		std::vector<uint32_t> Table(size_t(1) << HashBits, 0);
+
+		size_t Pos = 0;
+		size_t Anchor = 0;
+
+		while (Pos + MinMatch <= SrcSize)
+		{
+			uint32_t Sequence = Read32(Src + Pos);
+			uint32_t& Slot = Table[HashSequence(Sequence)];
+			size_t Candidate = Slot;
+			Slot = static_cast<uint32_t>(Pos + 1);
+
+			if (Candidate != 0 && Pos - (Candidate - 1) <= MaxOffset && Read32(Src + Candidate - 1) == Sequence)
+			{
+				Candidate -= 1;
+				size_t Length = MinMatch;
+				while (Pos + Length < SrcSize && Src[Candidate + Length] == Src[Pos + Length])
+					++Length;
+
+				EmitSequence(Out, Src + Anchor, Pos - Anchor, Pos - Candidate, Length);
+				Pos += Length;
+				Anchor = Pos;
+			}
+			else
+			{
+				++Pos;
+			}
+		}
+
+		// Trailing literals, no match
+		EmitSequence(Out, Src + Anchor, SrcSize - Anchor, 0, 0);
+
+		return Out.size() - Start;
+	}
+
+	bool DecompressBlock(const uint8_t* Src, size_t SrcSize, uint8_t* Dst, size_t RawSize)
+	{
+		size_t SrcPos = 0;
+		size_t DstPos = 0;
+
+		while (SrcPos < SrcSize)
+		{
+			uint8_t Token = Src[SrcPos++];
+
+			size_t LiteralLength = Token >> 4;
+			if (LiteralLength == 15 && !ReadLength(Src, SrcSize, SrcPos, LiteralLength))
+				return false;
+			if (LiteralLength > SrcSize - SrcPos || LiteralLength > RawSize - DstPos)
+				return false;
+
+			std::memcpy(Dst + DstPos, Src + SrcPos, LiteralLength);
+			SrcPos += LiteralLength;
+			DstPos += LiteralLength;
+
+			if (SrcPos == SrcSize)
+				break;
+
+			if (SrcSize - SrcPos < 2)
+				return false;
+			size_t Offset = Src[SrcPos] | (size_t(Src[SrcPos + 1]) << 8);
+			SrcPos += 2;
+			if (Offset == 0 || Offset > DstPos)
+				return false;
+
+			size_t MatchLength = Token & 0x0F;
+			if (MatchLength == 15 && !ReadLength(Src, SrcSize, SrcPos, MatchLength))
+				return false;
+			MatchLength += MinMatch;
+			if (MatchLength > RawSize - DstPos)
+				return false;
+
+			// Byte copy: source and destination may overlap for run-length style matches
+			const uint8_t* Match = Dst + DstPos - Offset;
+			for (size_t i = 0; i < MatchLength; ++i)
+				Dst[DstPos + i] = Match[i];
+			DstPos += MatchLength;
+		}
+
+		return DstPos == RawSize;
+	}
+
+	bool CompressFile(const std::string& SrcPath, const std::string& DstPath)
+	{
+		std::ifstream In(SrcPath, std::ios::binary);
+		if (!In.is_open())
+			return false;
+
+		// Write to a temporary name so a partially written segment is never mistaken for a complete one
+		std::string TempPath = DstPath + ".tmp";
+		std::ofstream Out(TempPath, std::ios::binary | std::ios::trunc);
+		if (!Out.is_open())
+			return false;
+
+		Out.write(FileMagic, sizeof(FileMagic));
+
+		std::vector<uint8_t> Raw(BlockSize);
+		std::vector<uint8_t> Packed;
+		Packed.reserve(BlockSize + BlockSize / 255 + 16);
+
+		while (In)
+		{
+			In.read(reinterpret_cast<char*>(Raw.data()), Raw.size());
+			size_t RawSize = static_cast<size_t>(In.gcount());
+			if (RawSize == 0)
+				break;
+
+			Packed.clear();
+			CompressBlock(Raw.data(), RawSize, Packed);
+
+			const uint8_t* Stored = Packed.data();
+			size_t StoredSize = Packed.size();
+			if (StoredSize >= RawSize)
+			{
+				Stored = Raw.data();
+				StoredSize = RawSize;
+			}
+
+			uint32_t Header[2] = { static_cast<uint32_t>(RawSize), static_cast<uint32_t>(StoredSize) };
+			Out.write(reinterpret_cast<const char*>(Header), sizeof(Header));
+			Out.write(reinterpret_cast<const char*>(Stored), StoredSize);
+		}
+
+		Out.close();
+		In.close();
+		if (!Out)
+		{
+			std::error_code Ec;
+			std::filesystem::remove(TempPath, Ec);
+			return false;
+		}
+
+		std::error_code Ec;
+		std::filesystem::rename(TempPath, DstPath, Ec);
+		return !Ec;
+	}
+
+	bool DecompressBuffer(const uint8_t* Src, size_t SrcSize, std::vector<uint8_t>& Out)
+	{
+		if (SrcSize < sizeof(FileMagic) || std::memcmp(Src, FileMagic, sizeof(FileMagic)) != 0)
+			return false;
+
+		size_t Pos = sizeof(FileMagic);
+		while (Pos < SrcSize)
+		{
+			if (SrcSize - Pos < 8)
+				return false;
+
+			uint32_t RawSize = Read32(Src + Pos);
+			uint32_t StoredSize = Read32(Src + Pos + 4);
+			Pos += 8;
+			if (StoredSize > SrcSize - Pos || RawSize > BlockSize)
+				return false;
+
+			size_t Base = Out.size();
+			Out.resize(Base + RawSize);
+			if (StoredSize == RawSize)
+			{
+				std::memcpy(Out.data() + Base, Src + Pos, RawSize);
+			}
+			else if (!DecompressBlock(Src + Pos, StoredSize, Out.data() + Base, RawSize))
+			{
+				return false;
+			}
+			Pos += StoredSize;
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+* Bundled LZ77-class codec for sealed log segments
+* Byte-oriented, LZ4-style sequences (literal run + back-reference into a 64 KB window),
+* no external dependencies and no Windows headers so offline tools can link it too.
+*
+* File layout: "BLZ1" magic, then blocks of
+*   uint32 RawSize, uint32 StoredSize, StoredSize bytes
+* where StoredSize == RawSize means the block is stored uncompressed.
+*/
+
+namespace LogCompression
+{
+	constexpr char FileMagic[4] = { 'B', 'L', 'Z', '1' };
+	constexpr size_t BlockSize = 1 << 20;
+	constexpr const char* FileExtension = ".lz";
+
+	// Compress one block, appending to Out. Returns the number of bytes appended.
+	size_t CompressBlock(const uint8_t* Src, size_t SrcSize, std::vector<uint8_t>& Out);
+
+	// Decompress one block into Dst (exactly RawSize bytes). Returns false on corrupt input.
+	bool DecompressBlock(const uint8_t* Src, size_t SrcSize, uint8_t* Dst, size_t RawSize);
+
+	// Compress a whole file into the block format above
+	bool CompressFile(const std::string& SrcPath, const std::string& DstPath);
+
+	// Decompress a whole in-memory .lz image (e.g. a mapped file) into Out
+	bool DecompressBuffer(const uint8_t* Src, size_t SrcSize, std::vector<uint8_t>& Out);
+}
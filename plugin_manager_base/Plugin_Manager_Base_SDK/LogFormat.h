@@ -0,0 +1,217 @@
+#pragma once
+
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <format>
+#include <string_view>
+
+/**
+* Shared log record formatting
+* Used by FunctionLogger, HookSystem and the GUI's GUILogger; the FUNCTION CALL record and the
+* GUI line are built here so tools/LogFormatTest checks the real layouts. Everything formats into
+* caller-provided fixed buffers (no std::string / std::stringstream temporaries), and the
+* timestamp prefix is cached per second so only the millisecond digits change per call.
+* Builds on Linux too, for tools/LogFormatTest.
+*/
+
+namespace LogFormat
+{
+	// Fixed-capacity, always null-terminated text buffer. Output past capacity is truncated.
+	template <size_t Capacity>
+	class FixedBuffer
+	{
+	public:
+		static_assert(Capacity > 1, "FixedBuffer needs room for at least one char and the terminator");
+
+		FixedBuffer() { Data[0] = '\0'; }
+
+		void Clear()
+		{
+			Length = 0;
+			Data[0] = '\0';
+		}
+
+		void Append(std::string_view Text)
+		{
+			size_t Count = (std::min)(Text.size(), Remaining());
+			std::memcpy(Data + Length, Text.data(), Count);
+			Length += Count;
+			Data[Length] = '\0';
+		}
+
+		void Append(char C)
+		{
+			if (Remaining() == 0)
+				return;
+			Data[Length++] = C;
+			Data[Length] = '\0';
+		}
+
+		// std::format syntax, e.g. Format("{} | Address: 0x{:x}", Name, Address)
+		template <typename... Args>
+		void Format(std::format_string<Args...> Fmt, Args&&... Arguments)
+		{
+			auto Result = std::format_to_n(Data + Length, Remaining(), Fmt, std::forward<Args>(Arguments)...);
+			Length = static_cast<size_t>(Result.out - Data);
+			Data[Length] = '\0';
+		}
+
+		// Ensure the record ends with exactly one newline (kept even when the text was truncated)
+		void TerminateLine()
+		{
+			if (Length > 0 && Data[Length - 1] == '\n')
+				return;
+			if (Remaining() == 0)
+				--Length;
+			Data[Length++] = '\n';
+			Data[Length] = '\0';
+		}
+
+		const char* CStr() const { return Data; }
+		std::string_view View() const { return std::string_view(Data, Length); }
+		size_t Size() const { return Length; }
+
+	private:
+		size_t Remaining() const { return Capacity - 1 - Length; }
+
+		char Data[Capacity];
+		size_t Length = 0;
+	};
+
+	enum class TimestampStyle
+	{
+		DateTime,	// 2025-01-31 13:37:00.123
+		Time		// 13:37:00.123
+	};
+
+	// Longest timestamp written by WriteTimestamp (without terminator)
+	constexpr size_t MaxTimestampLength = 23;
+
+	// Writes the current local time into Out (at least MaxTimestampLength bytes), returns the length.
+	// localtime_s + strftime run once per second per thread; other calls only patch the milliseconds.
+	inline size_t WriteTimestamp(char* Out, TimestampStyle Style)
+	{
+		struct CachedPrefix
+		{
+			int64_t Second = -1;
+			char Text[24] = {};
+			size_t Length = 0;
+		};
+		thread_local CachedPrefix Cache[2];
+
+		auto Now = std::chrono::system_clock::now();
+		int64_t Millis = std::chrono::duration_cast<std::chrono::milliseconds>(Now.time_since_epoch()).count();
+		int64_t Second = Millis / 1000;
+		int Milli = static_cast<int>(Millis % 1000);
+
+		CachedPrefix& Prefix = Cache[Style == TimestampStyle::DateTime ? 0 : 1];
+		if (Prefix.Second != Second)
+		{
+			time_t Time = static_cast<time_t>(Second);
+			struct tm TimeInfo;
+#ifdef _WIN32
+			localtime_s(&TimeInfo, &Time);
+#else
+			localtime_r(&Time, &TimeInfo);
+#endif
+			Prefix.Length = std::strftime(Prefix.Text, sizeof(Prefix.Text),
+				Style == TimestampStyle::DateTime ? "%Y-%m-%d %H:%M:%S" : "%H:%M:%S", &TimeInfo);
+			Prefix.Second = Second;
+		}
+
+		std::memcpy(Out, Prefix.Text, Prefix.Length);
+		char* Tail = Out + Prefix.Length;
+		Tail[0] = '.';
+		Tail[1] = static_cast<char>('0' + Milli / 100);
+		Tail[2] = static_cast<char>('0' + (Milli / 10) % 10);
+		Tail[3] = static_cast<char>('0' + Milli % 10);
+		return Prefix.Length + 4;
+	}
+
+	// Appends "[<timestamp>] " to a record
+	template <size_t Capacity>
+	inline void AppendTimestamp(FixedBuffer<Capacity>& Buffer, TimestampStyle Style)
+	{
+		char Stamp[MaxTimestampLength + 1];
+		size_t Length = WriteTimestamp(Stamp, Style);
+		Buffer.Append('[');
+		Buffer.Append(std::string_view(Stamp, Length));
+		Buffer.Append("] ");
+	}
+
+	// Optional fields of a FUNCTION CALL record (FunctionLogger's [Output] switches)
+	struct FunctionCallFields
+	{
+		bool bObjectPath = true;
+		bool bAddress = true;
+		bool bParameters = true;
+		bool bReturnValue = true;
+	};
+
+	// "[<date time>] FUNCTION CALL | Object: ... | Name: ... | Address: 0x... | Params: ... | Return: ... | Duration: ...us"
+	// Empty strings and a negative duration leave their field out.
+	template <size_t Capacity>
+	inline void FormatFunctionCall(
+		FixedBuffer<Capacity>& Record,
+		const FunctionCallFields& Fields,
+		std::string_view FunctionName,
+		std::string_view ObjectPath,
+		uintptr_t FunctionAddress,
+		std::string_view Parameters,
+		std::string_view ReturnValue,
+		int64_t DurationMicroseconds)
+	{
+		Record.Clear();
+		AppendTimestamp(Record, TimestampStyle::DateTime);
+		Record.Append("FUNCTION CALL");
+
+		if (Fields.bObjectPath && !ObjectPath.empty())
+		{
+			Record.Append(" | Object: ");
+			Record.Append(ObjectPath);
+		}
+
+		Record.Append(" | Name: ");
+		Record.Append(FunctionName);
+
+		if (Fields.bAddress)
+		{
+			Record.Format(" | Address: 0x{:x}", FunctionAddress);
+		}
+
+		if (Fields.bParameters && !Parameters.empty())
+		{
+			Record.Append(" | Params: ");
+			Record.Append(Parameters);
+		}
+
+		if (Fields.bReturnValue && !ReturnValue.empty())
+		{
+			Record.Append(" | Return: ");
+			Record.Append(ReturnValue);
+		}
+
+		if (DurationMicroseconds >= 0)
+		{
+			Record.Format(" | Duration: {}us", DurationMicroseconds);
+		}
+
+		Record.TerminateLine();
+	}
+
+	// GUILogger line: "[<time>] <message>"
+	template <size_t Capacity>
+	inline void FormatGuiLine(FixedBuffer<Capacity>& Line, std::string_view Message)
+	{
+		Line.Clear();
+		AppendTimestamp(Line, TimestampStyle::Time);
+		Line.Append(Message);
+		Line.TerminateLine();
+	}
+}
@@ -1,8 +1,19 @@
 #include "Logger.hpp"
+#include "LogCompression.h"
+
+#include <filesystem>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+// One formatted record, built on the stack; longer records are truncated
+using LogRecord = LogFormat::FixedBuffer<4096>;
 
 bool FunctionLogger::Initialize(const std::string& ConfigPath, const std::string& LogDirectory)
 {
-	if (!ParseConfigFile(ConfigPath))
+	auto NewConfig = std::make_unique<LogConfig>();
+	bool bConfigLoaded = ParseConfigFile(ConfigPath, *NewConfig);
+	if (!bConfigLoaded)
 	{
 		// Config file not found, using defaults (no console message needed)
 		OutputDebugStringA("FunctionLogger: Config file not found or failed to parse, using defaults.\n");
@@ -11,35 +22,58 @@ bool FunctionLogger::Initialize(const std::string& ConfigPath, const std::string
 	if (!LogDirectory.empty())
 	{
 		std::string FullLogPath = LogDirectory;
-		size_t LastSlash = Config.LogFilePath.find_last_of("\\");
+		size_t LastSlash = NewConfig->LogFilePath.find_last_of("\\");
 		if (LastSlash == std::string::npos)
 		{
-			LastSlash = Config.LogFilePath.find_last_of("/");
+			LastSlash = NewConfig->LogFilePath.find_last_of("/");
 		}
-		std::string FileName = (LastSlash != std::string::npos) ? Config.LogFilePath.substr(LastSlash + 1) : Config.LogFilePath;
+		std::string FileName = (LastSlash != std::string::npos) ? NewConfig->LogFilePath.substr(LastSlash + 1) : NewConfig->LogFilePath;
 		FullLogPath += FileName;
-		Config.LogFilePath = FullLogPath;
+		NewConfig->LogFilePath = FullLogPath;
 	}
 
+	CompileConfig(*NewConfig);
+	ConfigState.Publish(std::move(NewConfig));
+	ConfigFilePath = ConfigPath;
+
+	std::shared_ptr<const LogConfig> Snapshot = ConfigState.Get();
+	const LogConfig& Config = *Snapshot;
+
 	if (Config.bLogToFile)
 	{
-		LogFile.open(Config.LogFilePath, std::ios::trunc);
-		if (!LogFile.is_open())
+		LogFile.Open(Config.LogFilePath);
+		if (!LogFile.IsOpen())
 		{
 			std::string msg = "FunctionLogger: Failed to open log file: " + Config.LogFilePath + "\n";
 			OutputDebugStringA(msg.c_str());
-			Config.bLogToFile = false;
 		}
+		else
+		{
+			bFileOutputEnabled = true;
+			ActiveBytes = 0;
+			ActiveOpenedAt = std::chrono::steady_clock::now();
+			ScanExistingSegments();
+			StartSegmentWorker();
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(StatsMutex);
+		FunctionStatsMap.clear();
+		LastSummaryAt = std::chrono::steady_clock::now();
 	}
 
 	bInitialized = true;
 
 	std::string InitMsg = "=== Function Logger Initialized ===\n";
+	InitMsg += "Config File: " + ConfigFilePath + (bConfigLoaded ? " (reloaded on change)" : " (not found, using defaults)") + "\n";
 	InitMsg += "Keyword Filtering: " + std::string(Config.bEnableKeywordFiltering ? "ENABLED" : "DISABLED") + "\n";
 	InitMsg += "Log to Console: " + std::string(Config.bLogToConsole ? "YES" : "NO") + "\n";
-	InitMsg += "Log to File: " + std::string(Config.bLogToFile ? "YES" : "NO") + "\n";
+	InitMsg += "Log to File: " + std::string(bFileOutputEnabled ? "YES" : "NO") + "\n";
 	InitMsg += "Log Function Address: " + std::string(Config.bLogFunctionAddress ? "YES" : "NO") + "\n";
 	InitMsg += "Log Full Paths: " + std::string(Config.bLogFullPaths ? "YES" : "NO") + "\n";
+	InitMsg += "Rate Limit: " + std::to_string(Config.DefaultRateLimit.iMaxCallsPerSecond) + "/s, sample 1 in " + std::to_string(Config.DefaultRateLimit.iSampleEveryN) + ", " + std::to_string(Config.RateLimitOverrides.size()) + " overrides, summary every " + std::to_string(Config.iSummaryIntervalSeconds) + " s\n";
+	InitMsg += "Rotation: " + std::to_string(Config.iMaxLogFileSizeMB) + " MB / " + std::to_string(Config.iRotateIntervalMinutes) + " min, keep " + std::to_string(Config.iMaxLogSegments) + " segments" + (Config.bCompressSegments ? " (compressed)" : "") + "\n";
 
 	if (Config.bEnableKeywordFiltering && !Config.FilterKeywords.empty())
 	{
@@ -56,11 +90,14 @@ bool FunctionLogger::Initialize(const std::string& ConfigPath, const std::string
 
 	// Only log to file and debug output, not console
 	OutputDebugStringA(InitMsg.c_str());
-	if (Config.bLogToFile && LogFile.is_open())
+	if (bFileOutputEnabled && LogFile.IsOpen())
 	{
-		LogFile << InitMsg;
+		LogFile.Append(InitMsg);
 	}
 
+	// config.ini changes apply without restarting the game
+	ConfigWatcherInstance.Start(ConfigFilePath, [this]() { ReloadConfig(); });
+
 	return true;
 }
 
@@ -69,46 +106,65 @@ void FunctionLogger::LogFunctionCall(
 	const std::string& ObjectPath,
 	uintptr_t FunctionAddress,
 	const std::string& Parameters,
-	const std::string& ReturnValue
+	const std::string& ReturnValue,
+	int64_t DurationMicroseconds
 )
 {
+	std::shared_ptr<const LogConfig> Snapshot = ConfigState.Get();
+	const LogConfig& Config = *Snapshot;
 	if (!bInitialized) return;
 
-	if (!ShouldLog(FunctionName))
+	bool bShouldLog = FunctionAddress != 0
+		? ShouldLog(Config, FunctionAddress, [&FunctionName]() -> const std::string& { return FunctionName; })
+		: ShouldLog(Config, FunctionName);
+	if (!bShouldLog)
 		return;
 
-	std::lock_guard<std::mutex> Lock(LogMutex);
-
-	std::stringstream SS;
-	SS << "[" << GetTimestamp() << "] ";
-	SS << "FUNCTION CALL";
-
-	if (Config.bLogFullPaths && !ObjectPath.empty())
-	{
-		SS << " | Object: " << ObjectPath;
-	}
+	WriteFunctionCall(Config, FunctionName, ObjectPath, FunctionAddress, Parameters, ReturnValue, DurationMicroseconds);
+}
 
-	SS << " | Name: " << FunctionName;
+void FunctionLogger::LogHookedCall(
+	const std::string& FunctionName,
+	const std::string& ObjectPath,
+	uintptr_t FunctionAddress,
+	const std::string& Parameters,
+	const std::string& ReturnValue,
+	int64_t DurationMicroseconds
+)
+{
+	std::shared_ptr<const LogConfig> Snapshot = ConfigState.Get();
+	const LogConfig& Config = *Snapshot;
+	if (!bInitialized) return;
 
-	if (Config.bLogFunctionAddress)
-	{
-		SS << " | Address: 0x" << std::hex << FunctionAddress << std::dec;
-	}
+	WriteFunctionCall(Config, FunctionName, ObjectPath, FunctionAddress, Parameters, ReturnValue, DurationMicroseconds);
+}
 
-	if (Config.bLogParameters && !Parameters.empty())
-	{
-		SS << " | Params: " << Parameters;
-	}
+void FunctionLogger::WriteFunctionCall(
+	const LogConfig& Config,
+	const std::string& FunctionName,
+	const std::string& ObjectPath,
+	uintptr_t FunctionAddress,
+	const std::string& Parameters,
+	const std::string& ReturnValue,
+	int64_t DurationMicroseconds
+)
+{
+	if (Config.bRateTrackingEnabled && !AdmitCall(Config, FunctionName, DurationMicroseconds))
+		return;
 
-	if (Config.bLogReturnValues && !ReturnValue.empty())
-	{
-		SS << " | Return: " << ReturnValue;
-	}
+	LogFormat::FunctionCallFields Fields;
+	Fields.bObjectPath = Config.bLogFullPaths;
+	Fields.bAddress = Config.bLogFunctionAddress;
+	Fields.bParameters = Config.bLogParameters;
+	Fields.bReturnValue = Config.bLogReturnValues;
 
-	std::string Message = SS.str();
+	LogRecord Record;
+	LogFormat::FormatFunctionCall(Record, Fields, FunctionName, ObjectPath, FunctionAddress,
+		Parameters, ReturnValue, DurationMicroseconds);
 
-	WriteToConsole(Message);
-	WriteToFile(Message);
+	std::lock_guard<std::mutex> Lock(LogMutex);
+	WriteToConsole(Config, Record.View());
+	WriteToFile(Config, Record.View());
 }
 
 void FunctionLogger::LogSignatureScan(
@@ -118,57 +174,64 @@ void FunctionLogger::LogSignatureScan(
 	const std::string& Details
 )
 {
+	std::shared_ptr<const LogConfig> Snapshot = ConfigState.Get();
+	const LogConfig& Config = *Snapshot;
 	if (!Config.bLogScanResults) return;
 
-	std::lock_guard<std::mutex> Lock(LogMutex);
-
-	std::stringstream SS;
-	SS << "[" << GetTimestamp() << "] ";
-	SS << "SIGNATURE SCAN | " << SignatureName << ": ";
-	SS << (bFound ? "FOUND" : "NOT FOUND");
+	LogRecord Record;
+	LogFormat::AppendTimestamp(Record, LogFormat::TimestampStyle::DateTime);
+	Record.Append("SIGNATURE SCAN | ");
+	Record.Append(SignatureName);
+	Record.Append(bFound ? ": FOUND" : ": NOT FOUND");
 
 	if (bFound)
 	{
-		SS << " | Address: 0x" << std::hex << Address << std::dec;
+		Record.Format(" | Address: 0x{:x}", Address);
 	}
 
 	if (!Details.empty())
 	{
-		SS << " | Details: " << Details;
+		Record.Append(" | Details: ");
+		Record.Append(Details);
 	}
 
-	std::string Message = SS.str();
+	Record.TerminateLine();
 
-	WriteToConsole(Message);
-	WriteToFile(Message);
+	std::lock_guard<std::mutex> Lock(LogMutex);
+	WriteToConsole(Config, Record.View());
+	WriteToFile(Config, Record.View());
 }
 
 void FunctionLogger::LogDiagnostic(const std::string& Message)
 {
-	std::lock_guard<std::mutex> Lock(LogMutex);
+	std::shared_ptr<const LogConfig> Snapshot = ConfigState.Get();
+	const LogConfig& Config = *Snapshot;
 
-	std::stringstream SS;
-	SS << "[" << GetTimestamp() << "] ";
-	SS << "DIAGNOSTIC | " << Message;
+	LogRecord Record;
+	LogFormat::AppendTimestamp(Record, LogFormat::TimestampStyle::DateTime);
+	Record.Append("DIAGNOSTIC | ");
+	Record.Append(Message);
+	Record.TerminateLine();
 
-	std::string FullMessage = SS.str();
-
-	WriteToConsole(FullMessage);
-	WriteToFile(FullMessage);
+	std::lock_guard<std::mutex> Lock(LogMutex);
+	WriteToConsole(Config, Record.View());
+	WriteToFile(Config, Record.View());
 }
 
 void FunctionLogger::LogError(const std::string& Message)
 {
-	std::lock_guard<std::mutex> Lock(LogMutex);
-
-	std::stringstream SS;
-	SS << "[" << GetTimestamp() << "] ";
-	SS << "ERROR | " << Message;
+	std::shared_ptr<const LogConfig> Snapshot = ConfigState.Get();
+	const LogConfig& Config = *Snapshot;
 
-	std::string FullMessage = SS.str();
+	LogRecord Record;
+	LogFormat::AppendTimestamp(Record, LogFormat::TimestampStyle::DateTime);
+	Record.Append("ERROR | ");
+	Record.Append(Message);
+	Record.TerminateLine();
 
-	WriteToConsole(FullMessage);
-	WriteToFile(FullMessage);
+	std::lock_guard<std::mutex> Lock(LogMutex);
+	WriteToConsole(Config, Record.View());
+	WriteToFile(Config, Record.View());
 }
 
 void FunctionLogger::LogSignaturePattern(
@@ -178,91 +241,235 @@ void FunctionLogger::LogSignaturePattern(
 	const std::string& Pattern
 )
 {
+	std::shared_ptr<const LogConfig> Snapshot = ConfigState.Get();
+	const LogConfig& Config = *Snapshot;
 	if (!Config.bLogSignaturePatterns) return;
 
-	std::lock_guard<std::mutex> Lock(LogMutex);
-
-	std::stringstream SS;
-	SS << "[" << GetTimestamp() << "] ";
-	SS << "SIGNATURE PATTERN | " << FunctionName << " @ 0x" << std::hex << Address << std::dec << "\n";
+	LogRecord Record;
+	LogFormat::AppendTimestamp(Record, LogFormat::TimestampStyle::DateTime);
+	Record.Format("SIGNATURE PATTERN | {} @ 0x{:x}\n", FunctionName, Address);
 
 	// Log the AOB pattern (with wildcards)
-	SS << "Pattern: " << Pattern << "\n";
+	Record.Append("Pattern: ");
+	Record.Append(Pattern);
+	Record.Append('\n');
 
 	// Log raw bytes
-	SS << "Bytes: ";
+	Record.Append("Bytes: ");
 	for (size_t i = 0; i < PatternBytes.size() && i < static_cast<size_t>(Config.iMaxPatternBytes); ++i)
 	{
-		SS << std::hex << std::setfill('0') << std::setw(2) << static_cast<int>(PatternBytes[i]) << " " << std::dec;
+		Record.Format("{:02x} ", PatternBytes[i]);
 	}
 	if (PatternBytes.size() > static_cast<size_t>(Config.iMaxPatternBytes))
 	{
-		SS << "... (truncated)";
+		Record.Append("... (truncated)");
 	}
-	SS << "\n";
+	Record.TerminateLine();
 
-	std::string FullMessage = SS.str();
+	std::lock_guard<std::mutex> Lock(LogMutex);
 
 	// Don't log to console - only to file and debug output
-	OutputDebugStringA(FullMessage.c_str());
+	OutputDebugStringA(Record.CStr());
 
 	if (Config.bLogSignaturePatterns)
 	{
 		std::ofstream SigFile(Config.SignatureLogPath, std::ios::app);
 		if (SigFile.is_open())
 		{
-			SigFile << FullMessage;
+			SigFile.write(Record.CStr(), Record.Size());
 			SigFile.close();
 		}
 	}
 }
 
-bool FunctionLogger::ShouldLog(const std::string& FunctionName)
+bool FunctionLogger::ShouldLog(std::string_view FunctionName)
+{
+	return ShouldLog(*ConfigState.Get(), FunctionName);
+}
+
+bool FunctionLogger::ShouldLog(const LogConfig& Config, std::string_view FunctionName)
 {
 	if (!Config.bEnableKeywordFiltering)
 		return true;
 
-	if (Config.FilterKeywords.empty())
+	if (Config.KeywordFilter.IsEmpty())
 		return true;
 
-	std::string LowerFunctionName = ToLowercase(FunctionName);
+	return Config.KeywordFilter.Matches(FunctionName);
+}
+
+bool FunctionLogger::FindVerdict(const LogConfig& Config, uintptr_t FunctionKey, bool& bOutVerdict)
+{
+	std::shared_lock<std::shared_mutex> Lock(Config.VerdictMutex);
+	auto It = Config.VerdictCache.find(FunctionKey);
+	if (It == Config.VerdictCache.end())
+		return false;
+
+	bOutVerdict = It->second;
+	return true;
+}
+
+void FunctionLogger::StoreVerdict(const LogConfig& Config, uintptr_t FunctionKey, bool bVerdict)
+{
+	std::unique_lock<std::shared_mutex> Lock(Config.VerdictMutex);
+	Config.VerdictCache.emplace(FunctionKey, bVerdict);
+}
+
+bool FunctionLogger::AdmitCall(const LogConfig& Config, std::string_view FunctionName, int64_t DurationMicroseconds)
+{
+	auto Now = std::chrono::steady_clock::now();
+	bool bAdmitted = true;
+	bool bSummaryDue = false;
 
-	for (const auto& Keyword : Config.FilterKeywords)
 	{
-		if (LowerFunctionName.find(ToLowercase(Keyword)) != std::string::npos)
-			return true;
+		std::lock_guard<std::mutex> Lock(StatsMutex);
+
+		auto It = FunctionStatsMap.find(FunctionName);
+		if (It == FunctionStatsMap.end())
+		{
+			It = FunctionStatsMap.emplace(std::string(FunctionName), FunctionStats{}).first;
+			auto Override = Config.RateLimitOverrides.find(It->first);
+			It->second.Limit = Override != Config.RateLimitOverrides.end() ? Override->second : Config.DefaultRateLimit;
+		}
+		FunctionStats& Stats = It->second;
+
+		++Stats.Calls;
+		if (DurationMicroseconds >= 0)
+		{
+			if (Stats.TimedCalls == 0 || DurationMicroseconds < Stats.MinDuration)
+				Stats.MinDuration = DurationMicroseconds;
+			if (Stats.TimedCalls == 0 || DurationMicroseconds > Stats.MaxDuration)
+				Stats.MaxDuration = DurationMicroseconds;
+			Stats.TotalDuration += DurationMicroseconds;
+			++Stats.TimedCalls;
+		}
+
+		// 1-in-N sampling first, then a fixed one-second window for the rate limit
+		if (Stats.Limit.iSampleEveryN > 1 && (Stats.SampleCounter++ % Stats.Limit.iSampleEveryN) != 0)
+		{
+			bAdmitted = false;
+		}
+		else if (Stats.Limit.iMaxCallsPerSecond > 0)
+		{
+			int64_t Second = std::chrono::duration_cast<std::chrono::seconds>(Now.time_since_epoch()).count();
+			if (Second != Stats.WindowSecond)
+			{
+				Stats.WindowSecond = Second;
+				Stats.WindowCount = 0;
+			}
+			bAdmitted = Stats.WindowCount++ < Stats.Limit.iMaxCallsPerSecond;
+		}
+
+		if (!bAdmitted)
+			++Stats.Suppressed;
+
+		bSummaryDue = IsSummaryDueLocked(Config, Now);
 	}
 
-	return false;
+	if (bSummaryDue)
+		EmitSummaries();
+
+	return bAdmitted;
+}
+
+bool FunctionLogger::IsSummaryDueLocked(const LogConfig& Config, std::chrono::steady_clock::time_point Now) const
+{
+	int IntervalSeconds = Config.iSummaryIntervalSeconds;
+	return IntervalSeconds > 0 && Now - LastSummaryAt >= std::chrono::seconds(IntervalSeconds);
+}
+
+void FunctionLogger::EmitSummaries()
+{
+	std::shared_ptr<const LogConfig> Snapshot = ConfigState.Get();
+	const LogConfig& Config = *Snapshot;
+	if (!bInitialized || !Config.bRateTrackingEnabled)
+		return;
+
+	std::lock_guard<std::mutex> Lock(StatsMutex);
+	LastSummaryAt = std::chrono::steady_clock::now();
+
+	for (auto& [Name, Stats] : FunctionStatsMap)
+	{
+		if (Stats.Calls == 0)
+			continue;
+
+		LogRecord Record;
+		LogFormat::AppendTimestamp(Record, LogFormat::TimestampStyle::DateTime);
+		Record.Format("SUMMARY | Name: {} | Calls: {} | Logged: {} | Suppressed: {}",
+			Name, Stats.Calls, Stats.Calls - Stats.Suppressed, Stats.Suppressed);
+		if (Stats.TimedCalls > 0)
+		{
+			Record.Format(" | Duration(us): min {} / avg {} / max {}",
+				Stats.MinDuration, Stats.TotalDuration / static_cast<int64_t>(Stats.TimedCalls), Stats.MaxDuration);
+		}
+		Record.TerminateLine();
+
+		{
+			std::lock_guard<std::mutex> WriteLock(LogMutex);
+			WriteToConsole(Config, Record.View());
+			WriteToFile(Config, Record.View());
+		}
+
+		// Interval counters only; sampling and rate window state carry over
+		Stats.Calls = 0;
+		Stats.Suppressed = 0;
+		Stats.TimedCalls = 0;
+		Stats.MinDuration = 0;
+		Stats.MaxDuration = 0;
+		Stats.TotalDuration = 0;
+	}
 }
 
 void FunctionLogger::Flush()
 {
+	// Main's periodic flush also drives summaries for functions that went quiet
+	bool bSummaryDue = false;
+	{
+		std::shared_ptr<const LogConfig> Snapshot = ConfigState.Get();
+		std::lock_guard<std::mutex> Lock(StatsMutex);
+		bSummaryDue = Snapshot->bRateTrackingEnabled && IsSummaryDueLocked(*Snapshot, std::chrono::steady_clock::now());
+	}
+	if (bSummaryDue)
+		EmitSummaries();
+
 	std::lock_guard<std::mutex> Lock(LogMutex);
-	if (LogFile.is_open())
-		LogFile.flush();
+	if (LogFile.IsOpen())
+		LogFile.Sync();
 }
 
 void FunctionLogger::Shutdown()
 {
+	ConfigWatcherInstance.Stop();
+	EmitSummaries();
+
 	std::lock_guard<std::mutex> Lock(LogMutex);
 
-	if (LogFile.is_open())
+	if (LogFile.IsOpen())
+	{
+		LogFile.Append("Logger shutting down...\n");
+		LogFile.Close();
+	}
+
+	// Segments still queued stay on disk uncompressed and are picked up by the next session
 	{
-		LogFile << "Logger shutting down...\n";
-		LogFile.close();
+		std::lock_guard<std::mutex> SegmentLock(SegmentMutex);
+		bStopSegmentWorker = true;
 	}
+	SegmentCondition.notify_all();
 }
 
-bool FunctionLogger::ParseConfigFile(const std::string& ConfigPath)
+bool FunctionLogger::ParseConfigFile(const std::string& ConfigPath, LogConfig& Config)
 {
 	std::ifstream ConfigFile(ConfigPath);
 	if (!ConfigFile.is_open())
 		return false;
 
 	std::string Line;
+	std::string Section;
 	bool bInLoggingSection = false;
 	bool bInScanningSection = false;
+	bool bInRateLimitingSection = false;
+	bool bInObjectDumpSection = false;
 
 	while (std::getline(ConfigFile, Line))
 	{
@@ -272,16 +479,39 @@ bool FunctionLogger::ParseConfigFile(const std::string& ConfigPath)
 		Line.erase(0, Line.find_first_not_of(" \t\r\n"));
 		Line.erase(Line.find_last_not_of(" \t\r\n") + 1);
 
+		if (Line.size() > 2 && Line.front() == '[' && Line.back() == ']')
+			Section = Line.substr(1, Line.size() - 2);
+
 		if (Line == "[Logging]")
 		{
 			bInLoggingSection = true;
 			bInScanningSection = false;
+			bInRateLimitingSection = false;
+			bInObjectDumpSection = false;
 			continue;
 		}
 		else if (Line == "[SignatureScanning]")
 		{
 			bInLoggingSection = false;
 			bInScanningSection = true;
+			bInRateLimitingSection = false;
+			bInObjectDumpSection = false;
+			continue;
+		}
+		else if (Line == "[RateLimiting]")
+		{
+			bInLoggingSection = false;
+			bInScanningSection = false;
+			bInRateLimitingSection = true;
+			bInObjectDumpSection = false;
+			continue;
+		}
+		else if (Line == "[ObjectDump]")
+		{
+			bInLoggingSection = false;
+			bInScanningSection = false;
+			bInRateLimitingSection = false;
+			bInObjectDumpSection = true;
 			continue;
 		}
 
@@ -296,6 +526,8 @@ bool FunctionLogger::ParseConfigFile(const std::string& ConfigPath)
 		Value.erase(0, Value.find_first_not_of(" \t"));
 		Value.erase(Value.find_last_not_of(" \t") + 1);
 
+		Config.RawValues[Section.empty() ? Key : Section + "." + Key] = Value;
+
 		if (bInLoggingSection)
 		{
 			if (Key == "EnableKeywordFiltering")
@@ -353,6 +585,34 @@ bool FunctionLogger::ParseConfigFile(const std::string& ConfigPath)
 			{
 				Config.bLogFullPaths = (Value == "true" || Value == "1");
 			}
+			else if (Key == "MaxLogFileSizeMB")
+			{
+				try {
+					Config.iMaxLogFileSizeMB = std::stoi(Value);
+				} catch (...) {
+					Config.iMaxLogFileSizeMB = 64;
+				}
+			}
+			else if (Key == "RotateIntervalMinutes")
+			{
+				try {
+					Config.iRotateIntervalMinutes = std::stoi(Value);
+				} catch (...) {
+					Config.iRotateIntervalMinutes = 0;
+				}
+			}
+			else if (Key == "MaxLogSegments")
+			{
+				try {
+					Config.iMaxLogSegments = std::stoi(Value);
+				} catch (...) {
+					Config.iMaxLogSegments = 10;
+				}
+			}
+			else if (Key == "CompressSegments")
+			{
+				Config.bCompressSegments = (Value == "true" || Value == "1");
+			}
 		}
 		else if (bInScanningSection)
 		{
@@ -389,47 +649,401 @@ bool FunctionLogger::ParseConfigFile(const std::string& ConfigPath)
 				}
 			}
 		}
+		else if (bInRateLimitingSection)
+		{
+			if (Key == "MaxCallsPerSecond")
+			{
+				try {
+					Config.DefaultRateLimit.iMaxCallsPerSecond = std::stoi(Value);
+				} catch (...) {
+					Config.DefaultRateLimit.iMaxCallsPerSecond = 0;
+				}
+			}
+			else if (Key == "SampleEveryN")
+			{
+				try {
+					Config.DefaultRateLimit.iSampleEveryN = (std::max)(1, std::stoi(Value));
+				} catch (...) {
+					Config.DefaultRateLimit.iSampleEveryN = 1;
+				}
+			}
+			else if (Key == "SummaryIntervalSeconds")
+			{
+				try {
+					Config.iSummaryIntervalSeconds = std::stoi(Value);
+				} catch (...) {
+					Config.iSummaryIntervalSeconds = 0;
+				}
+			}
+			else if (Key == "Overrides")
+			{
+				// FunctionName:MaxCallsPerSecond:SampleEveryN, comma-separated
+				Config.RateLimitOverrides.clear();
+				std::stringstream Entries(Value);
+				std::string Entry;
+				while (std::getline(Entries, Entry, ','))
+				{
+					Entry.erase(0, Entry.find_first_not_of(" \t"));
+					Entry.erase(Entry.find_last_not_of(" \t") + 1);
+
+					size_t FirstColon = Entry.find(':');
+					if (FirstColon == std::string::npos || FirstColon == 0)
+						continue;
+					size_t SecondColon = Entry.find(':', FirstColon + 1);
+
+					LogConfig::RateLimit Limit;
+					try {
+						Limit.iMaxCallsPerSecond = std::stoi(Entry.substr(FirstColon + 1, SecondColon - FirstColon - 1));
+						if (SecondColon != std::string::npos)
+							Limit.iSampleEveryN = (std::max)(1, std::stoi(Entry.substr(SecondColon + 1)));
+					} catch (...) {
+						continue;
+					}
+					Config.RateLimitOverrides[Entry.substr(0, FirstColon)] = Limit;
+				}
+			}
+		}
+		else if (bInObjectDumpSection)
+		{
+			if (Key == "FullDump")
+			{
+				Config.bFullObjectDump = (Value == "true" || Value == "1");
+			}
+			else if (Key == "Snapshot")
+			{
+				Config.bObjectSnapshot = (Value == "true" || Value == "1");
+			}
+			else if (Key == "SnapshotIntervalSeconds")
+			{
+				try {
+					Config.iSnapshotIntervalSeconds = std::stoi(Value);
+				} catch (...) {
+					Config.iSnapshotIntervalSeconds = 0;
+				}
+			}
+			else if (Key == "DumpThreads")
+			{
+				try {
+					Config.iObjectDumpThreads = std::stoi(Value);
+				} catch (...) {
+					Config.iObjectDumpThreads = 0;
+				}
+			}
+		}
 	}
 
 	ConfigFile.close();
 	return true;
 }
 
-std::string FunctionLogger::GetTimestamp()
+void FunctionLogger::CompileConfig(LogConfig& Config)
+{
+	Config.KeywordFilter.Build(Config.FilterKeywords);
+	Config.bRateTrackingEnabled = Config.DefaultRateLimit.iMaxCallsPerSecond > 0 || Config.DefaultRateLimit.iSampleEveryN > 1 ||
+		!Config.RateLimitOverrides.empty() || Config.iSummaryIntervalSeconds > 0;
+}
+
+void FunctionLogger::ReloadConfig()
+{
+	auto NewConfig = std::make_unique<LogConfig>();
+	if (!ParseConfigFile(ConfigFilePath, *NewConfig))
+	{
+		LogError("Config reload failed, keeping the current configuration: " + ConfigFilePath);
+		return;
+	}
+
+	// The output file is opened once; these only take effect on the next start
+	std::shared_ptr<const LogConfig> Snapshot = ConfigState.Get();
+	const LogConfig& Current = *Snapshot;
+	NewConfig->bLogToFile = Current.bLogToFile;
+	NewConfig->LogFilePath = Current.LogFilePath;
+
+	// Name every key that was added, changed or removed, e.g. "RateLimiting.MaxCallsPerSecond=50 (was 0)"
+	std::string Changes;
+	auto AddChange = [&Changes](const std::string& Key, const std::string* Value, const std::string* Previous) {
+		Changes += Changes.empty() ? ": " : ", ";
+		Changes += Key + (Value ? "=" + *Value : " removed");
+		Changes += Previous ? " (was " + *Previous + ")" : (Value ? " (new)" : "");
+	};
+	for (const auto& [Key, Value] : NewConfig->RawValues)
+	{
+		auto It = Current.RawValues.find(Key);
+		if (It == Current.RawValues.end())
+			AddChange(Key, &Value, nullptr);
+		else if (It->second != Value)
+			AddChange(Key, &Value, &It->second);
+	}
+	for (const auto& [Key, Value] : Current.RawValues)
+	{
+		if (NewConfig->RawValues.find(Key) == NewConfig->RawValues.end())
+			AddChange(Key, nullptr, &Value);
+	}
+
+	CompileConfig(*NewConfig);
+
+	{
+		// Cached per-function limits came from the old snapshot
+		std::lock_guard<std::mutex> Lock(StatsMutex);
+		FunctionStatsMap.clear();
+		LastSummaryAt = std::chrono::steady_clock::now();
+		ConfigState.Publish(std::move(NewConfig));
+	}
+
+	LogDiagnostic("Configuration reloaded from " + ConfigFilePath + (Changes.empty() ? " (no key changed)" : Changes));
+}
+
+void FunctionLogger::WriteToFile(const LogConfig& Config, std::string_view Line)
 {
-	auto Now = std::chrono::system_clock::now();
-	auto Time = std::chrono::system_clock::to_time_t(Now);
+	if (bFileOutputEnabled && LogFile.IsOpen())
+	{
+		LogFile.Append(Line);
+		ActiveBytes += Line.size();
 
-	struct tm TimeInfo;
-	localtime_s(&TimeInfo, &Time);
+		bool bSizeExceeded = Config.iMaxLogFileSizeMB > 0 &&
+			ActiveBytes >= static_cast<uint64_t>(Config.iMaxLogFileSizeMB) * 1024 * 1024;
+		bool bIntervalElapsed = Config.iRotateIntervalMinutes > 0 &&
+			std::chrono::steady_clock::now() - ActiveOpenedAt >= std::chrono::minutes(Config.iRotateIntervalMinutes);
 
-	std::stringstream SS;
-	SS << std::put_time(&TimeInfo, "%Y-%m-%d %H:%M:%S");
-	return SS.str();
+		if (bSizeExceeded || bIntervalElapsed)
+		{
+			RotateLocked(Config);
+		}
+	}
 }
 
-std::string FunctionLogger::ToLowercase(const std::string& Str)
+void FunctionLogger::WriteToConsole(const LogConfig& Config, std::string_view Line)
 {
-	std::string Result = Str;
-	std::transform(Result.begin(), Result.end(), Result.begin(),
-		[](unsigned char C) { return std::tolower(C); });
-	return Result;
+	if (Config.bLogToConsole)
+	{
+		// Console output disabled - only log to debug output (Line is a null-terminated record)
+		OutputDebugStringA(Line.data());
+	}
 }
 
-void FunctionLogger::WriteToFile(const std::string& Message)
+void FunctionLogger::RotateLocked(const LogConfig& Config)
 {
-	if (Config.bLogToFile && LogFile.is_open())
+	// Only a close/rename/open happens on the producer; compression runs on the segment worker
+	LogFile.Close();
+
+	uint32_t SegmentIndex = NextSegmentIndex++;
+	std::string SegmentPath = GetSegmentPath(SegmentIndex);
+
+	std::error_code Ec;
+	fs::rename(Config.LogFilePath, SegmentPath, Ec);
+
+	LogFile.Open(Config.LogFilePath);
+	ActiveBytes = 0;
+	ActiveOpenedAt = std::chrono::steady_clock::now();
+
+	if (!LogFile.IsOpen())
+	{
+		OutputDebugStringA("FunctionLogger: Failed to reopen log file after rotation, file logging disabled.\n");
+		bFileOutputEnabled = false;
+		return;
+	}
+
+	if (Ec)
 	{
-		LogFile << Message << "\n";
+		// Rename failed (file locked by another process?), keep appending to a fresh file
+		std::string Msg = "FunctionLogger: Failed to seal segment " + SegmentPath + ": " + Ec.message() + "\n";
+		OutputDebugStringA(Msg.c_str());
+		return;
 	}
+
+	LogRecord Header;
+	Header.Format("=== Continued from segment {} ===\n", SegmentIndex);
+	LogFile.Append(Header.View());
+
+	{
+		std::lock_guard<std::mutex> SegmentLock(SegmentMutex);
+		PendingSegments.push_back(SegmentPath);
+	}
+	SegmentCondition.notify_one();
 }
 
-void FunctionLogger::WriteToConsole(const std::string& Message)
+std::string FunctionLogger::GetSegmentPath(uint32_t Index) const
 {
-	if (Config.bLogToConsole)
+	std::shared_ptr<const LogConfig> Snapshot = ConfigState.Get();
+	const LogConfig& Config = *Snapshot;
+	fs::path ActivePath(Config.LogFilePath);
+
+	char Suffix[16];
+	snprintf(Suffix, sizeof(Suffix), ".%06u", Index);
+
+	fs::path SegmentName = ActivePath.stem();
+	SegmentName += Suffix;
+	SegmentName += ActivePath.extension();
+	return (ActivePath.parent_path() / SegmentName).string();
+}
+
+void FunctionLogger::ScanExistingSegments()
+{
+	std::shared_ptr<const LogConfig> Snapshot = ConfigState.Get();
+	const LogConfig& Config = *Snapshot;
+	fs::path ActivePath(Config.LogFilePath);
+	fs::path Directory = ActivePath.parent_path().empty() ? fs::path(".") : ActivePath.parent_path();
+	std::string Prefix = ActivePath.stem().string() + ".";
+	std::string Extension = ActivePath.extension().string();
+
+	std::error_code Ec;
+	for (const auto& Entry : fs::directory_iterator(Directory, Ec))
+	{
+		std::string Name = Entry.path().filename().string();
+		bool bCompressed = Name.size() > 3 && Name.compare(Name.size() - 3, 3, LogCompression::FileExtension) == 0;
+		std::string Base = bCompressed ? Name.substr(0, Name.size() - 3) : Name;
+
+		if (Base.size() <= Prefix.size() + Extension.size() || Base.compare(0, Prefix.size(), Prefix) != 0 ||
+			Base.compare(Base.size() - Extension.size(), Extension.size(), Extension) != 0)
+			continue;
+
+		std::string Digits = Base.substr(Prefix.size(), Base.size() - Prefix.size() - Extension.size());
+		if (Digits.empty() || Digits.find_first_not_of("0123456789") != std::string::npos)
+			continue;
+
+		uint32_t Index = static_cast<uint32_t>(std::strtoul(Digits.c_str(), nullptr, 10));
+		NextSegmentIndex = (std::max)(NextSegmentIndex, Index + 1);
+
+		if (!bCompressed)
+		{
+			std::lock_guard<std::mutex> SegmentLock(SegmentMutex);
+			PendingSegments.push_back(Entry.path().string());
+		}
+	}
+}
+
+void FunctionLogger::StartSegmentWorker()
+{
+	std::lock_guard<std::mutex> SegmentLock(SegmentMutex);
+	if (bSegmentWorkerRunning)
+		return;
+
+	bSegmentWorkerRunning = true;
+	bStopSegmentWorker = false;
+
+	// Detached like the rest of our background threads: the process may exit without Shutdown()
+	std::thread(&FunctionLogger::SegmentWorkerLoop, this).detach();
+}
+
+void FunctionLogger::SegmentWorkerLoop()
+{
+	// Retention for segments found at startup
+	EnforceSegmentRetention();
+
+	while (true)
+	{
+		std::string SegmentPath;
+		{
+			std::unique_lock<std::mutex> SegmentLock(SegmentMutex);
+			SegmentCondition.wait(SegmentLock, [this]() { return bStopSegmentWorker || !PendingSegments.empty(); });
+
+			if (bStopSegmentWorker)
+			{
+				bSegmentWorkerRunning = false;
+				return;
+			}
+
+			SegmentPath = PendingSegments.front();
+			PendingSegments.pop_front();
+			CompressingSegment = SegmentPath;
+		}
+
+		if (ConfigState.Get()->bCompressSegments)
+		{
+			if (LogCompression::CompressFile(SegmentPath, SegmentPath + LogCompression::FileExtension))
+			{
+				std::error_code Ec;
+				fs::remove(SegmentPath, Ec);
+			}
+			else
+			{
+				std::string Msg = "FunctionLogger: Failed to compress segment " + SegmentPath + "\n";
+				OutputDebugStringA(Msg.c_str());
+			}
+		}
+
+		{
+			std::lock_guard<std::mutex> SegmentLock(SegmentMutex);
+			CompressingSegment.clear();
+		}
+
+		EnforceSegmentRetention();
+	}
+}
+
+void FunctionLogger::EnforceSegmentRetention()
+{
+	std::shared_ptr<const LogConfig> Snapshot = ConfigState.Get();
+	const LogConfig& Config = *Snapshot;
+	if (Config.iMaxLogSegments <= 0)
+		return;
+
+	fs::path ActivePath(Config.LogFilePath);
+	fs::path Directory = ActivePath.parent_path().empty() ? fs::path(".") : ActivePath.parent_path();
+	std::string Prefix = ActivePath.stem().string() + ".";
+	std::string Extension = ActivePath.extension().string();
+
+	// "<stem>.<digits><ext>[.lz4]" -> segment index
+	auto ParseIndex = [&](const std::string& Name, uint32_t& Index) -> bool
+	{
+		if (Name.compare(0, Prefix.size(), Prefix) != 0)
+			return false;
+
+		size_t DigitsEnd = Name.find_first_not_of("0123456789", Prefix.size());
+		if (DigitsEnd == Prefix.size() || DigitsEnd == std::string::npos ||
+			Name.compare(DigitsEnd, Extension.size(), Extension) != 0)
+			return false;
+
+		std::string Tail = Name.substr(DigitsEnd + Extension.size());
+		if (!Tail.empty() && Tail != LogCompression::FileExtension)
+			return false;
+
+		Index = static_cast<uint32_t>(std::strtoul(Name.c_str() + Prefix.size(), nullptr, 10));
+		return true;
+	};
+
+	// Segments still queued for (or in) compression are left alone; they count toward the
+	// limit and are removed by a later pass, once compressed, if they are still too old
+	std::vector<uint32_t> InUse;
+	{
+		std::lock_guard<std::mutex> SegmentLock(SegmentMutex);
+		uint32_t Index = 0;
+		for (const std::string& Pending : PendingSegments)
+		{
+			if (ParseIndex(fs::path(Pending).filename().string(), Index))
+				InUse.push_back(Index);
+		}
+		if (!CompressingSegment.empty() && ParseIndex(fs::path(CompressingSegment).filename().string(), Index))
+			InUse.push_back(Index);
+	}
+
+	// Index -> files (raw and/or compressed) belonging to that segment
+	std::vector<std::pair<uint32_t, fs::path>> Segments;
+
+	std::error_code Ec;
+	for (const auto& Entry : fs::directory_iterator(Directory, Ec))
+	{
+		uint32_t Index = 0;
+		if (ParseIndex(Entry.path().filename().string(), Index))
+			Segments.emplace_back(Index, Entry.path());
+	}
+
+	std::sort(Segments.begin(), Segments.end());
+
+	// Count distinct indices, oldest first
+	std::vector<uint32_t> Indices;
+	for (const auto& Segment : Segments)
+	{
+		if (Indices.empty() || Indices.back() != Segment.first)
+			Indices.push_back(Segment.first);
+	}
+
+	if (Indices.size() <= static_cast<size_t>(Config.iMaxLogSegments))
+		return;
+
+	uint32_t KeepFrom = Indices[Indices.size() - Config.iMaxLogSegments];
+	for (const auto& Segment : Segments)
 	{
-		// Console output disabled - only log to debug output
-		std::string msg = Message + "\n";
-		OutputDebugStringA(msg.c_str());
+		if (Segment.first < KeepFrom && std::find(InUse.begin(), InUse.end(), Segment.first) == InUse.end())
+			fs::remove(Segment.second, Ec);
 	}
 }
@@ -9,8 +9,20 @@
 #include <chrono>
 #include <iomanip>
 #include <algorithm>
+#include <map>
+#include <memory>
 #include <cctype>
 #include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include "ConfigWatcher.h"
+#include "KeywordMatcher.h"
+#include "LogFormat.h"
+#include "MappedLogSink.h"
 
 /**
 * Headless Function Logger
@@ -38,6 +50,39 @@ public:
 		bool bLogSignaturePatterns = false;
 		std::string SignatureLogPath = "signatures.txt";
 		int iMaxPatternBytes = 64;
+
+		// Rotation of LogFilePath into numbered segments (0 disables the respective trigger)
+		int iMaxLogFileSizeMB = 64;
+		int iRotateIntervalMinutes = 0;
+		int iMaxLogSegments = 10;
+		bool bCompressSegments = true;
+
+		// [RateLimiting] per-function limits for LogFunctionCall (0 / 1 = unlimited)
+		struct RateLimit
+		{
+			int iMaxCallsPerSecond = 0;
+			int iSampleEveryN = 1;
+		};
+		RateLimit DefaultRateLimit;
+		std::unordered_map<std::string, RateLimit> RateLimitOverrides;
+		int iSummaryIntervalSeconds = 60;
+
+		// [ObjectDump] full GObjects dump when the menu first opens (runs off the game thread)
+		bool bFullObjectDump = false;
+		bool bObjectSnapshot = false;   // binary .bos snapshot for tools/SnapshotQuery
+		int iSnapshotIntervalSeconds = 0;   // > 0: delta snapshot every N seconds after the first
+		int iObjectDumpThreads = 0;
+
+		// Every "Section.Key" as read from the file, so a reload can report what changed
+		std::map<std::string, std::string> RawValues;
+
+		// Derived at config load (CompileConfig)
+		KeywordMatcher KeywordFilter;
+		bool bRateTrackingEnabled = false;
+
+		// Memoized ShouldLog verdicts for this snapshot
+		mutable std::unordered_map<uintptr_t, bool> VerdictCache;
+		mutable std::shared_mutex VerdictMutex;
 	};
 
 	static FunctionLogger& Get()
@@ -49,13 +94,28 @@ public:
 	// Initialize logger with config file and optional log directory
 	bool Initialize(const std::string& ConfigPath = "config.ini", const std::string& LogDirectory = "");
 
-	// Log a function call with details
+	// Log a function call with details. Subject to [RateLimiting]: calls over the limit or
+	// skipped by sampling are only counted and show up in the periodic SUMMARY lines.
+	// FunctionAddress should be the UFunction: it keys the memoized keyword filter verdict
+	// (0 filters by name on every call). DurationMicroseconds < 0 means "not measured".
 	void LogFunctionCall(
 		const std::string& FunctionName,
 		const std::string& ObjectPath,
 		uintptr_t FunctionAddress,
 		const std::string& Parameters = "",
-		const std::string& ReturnValue = ""
+		const std::string& ReturnValue = "",
+		int64_t DurationMicroseconds = -1
+	);
+
+	// Same record for a function the caller hooked explicitly (e.g. MenuOpen): the keyword
+	// filter is skipped, [RateLimiting] still applies.
+	void LogHookedCall(
+		const std::string& FunctionName,
+		const std::string& ObjectPath,
+		uintptr_t FunctionAddress,
+		const std::string& Parameters = "",
+		const std::string& ReturnValue = "",
+		int64_t DurationMicroseconds = -1
 	);
 
 	// Log signature scan result
@@ -81,13 +141,26 @@ public:
 	);
 
 	// Check if a keyword matches the filter
-	bool ShouldLog(const std::string& FunctionName);
+	bool ShouldLog(std::string_view FunctionName);
+
+	// Same as above, but memoizes the verdict per function so repeated calls cost one lookup.
+	// FunctionKey is anything stable per function: the UFunction address or its FName index.
+	// GetFunctionName() is only called on a cache miss, so callers can defer building the name:
+	//   Logger.ShouldLog((uintptr_t)Function, [&]() { return Function->GetName(); })
+	template <typename NameFn>
+	bool ShouldLog(uintptr_t FunctionKey, const NameFn& GetFunctionName)
+	{
+		return ShouldLog(*ConfigState.Get(), FunctionKey, GetFunctionName);
+	}
+
+	// Write the per-function SUMMARY lines for the current interval now
+	void EmitSummaries();
 
-	// Flush output buffers
+	// Flush output buffers (also emits pending summaries)
 	void Flush();
 
-	// Get current configuration
-	const LogConfig& GetConfig() const { return Config; }
+	// Get current configuration (snapshot, replaced when config.ini changes on disk)
+	std::shared_ptr<const LogConfig> GetConfig() const { return ConfigState.Get(); }
 
 	// Manual shutdown (call this instead of relying on destructor)
 	void Shutdown();
@@ -99,23 +172,127 @@ private:
 	FunctionLogger(const FunctionLogger&) = delete;
 	FunctionLogger& operator=(const FunctionLogger&) = delete;
 
-	// Parse config file
-	bool ParseConfigFile(const std::string& ConfigPath);
+	// Parse config file into Config (no side effects on the logger)
+	bool ParseConfigFile(const std::string& ConfigPath, LogConfig& Config);
+
+	// Build the derived fields (keyword automaton, rate tracking flag) of a parsed config
+	static void CompileConfig(LogConfig& Config);
 
-	// Get current timestamp as string
-	std::string GetTimestamp();
+	// Called by the config watcher: parse config.ini again and publish a new snapshot
+	void ReloadConfig();
 
-	// Convert string to lowercase
-	std::string ToLowercase(const std::string& Str);
+	// ShouldLog against a snapshot the caller already holds (one snapshot per logged call)
+	bool ShouldLog(const LogConfig& Config, std::string_view FunctionName);
+	template <typename NameFn>
+	bool ShouldLog(const LogConfig& Config, uintptr_t FunctionKey, const NameFn& GetFunctionName);
 
-	// Write to file
-	void WriteToFile(const std::string& Message);
+	// Memoized verdict of FunctionKey in Config's cache, false if it has none yet
+	static bool FindVerdict(const LogConfig& Config, uintptr_t FunctionKey, bool& bOutVerdict);
+	static void StoreVerdict(const LogConfig& Config, uintptr_t FunctionKey, bool bVerdict);
+
+	// Rate limiting, formatting and output of a function call that passed (or skipped) the keyword filter
+	void WriteFunctionCall(
+		const LogConfig& Config,
+		const std::string& FunctionName,
+		const std::string& ObjectPath,
+		uintptr_t FunctionAddress,
+		const std::string& Parameters,
+		const std::string& ReturnValue,
+		int64_t DurationMicroseconds
+	);
 
-	// Write to console
-	void WriteToConsole(const std::string& Message);
+	// Write a finished record (ends in '\n') to the file
+	void WriteToFile(const LogConfig& Config, std::string_view Line);
 
-	LogConfig Config;
-	std::ofstream LogFile;
+	// Write a finished record to the debug output; Line must be null-terminated
+	void WriteToConsole(const LogConfig& Config, std::string_view Line);
+
+	// Count a call against its function's rate limit / sample rate, false if it should not be written
+	bool AdmitCall(const LogConfig& Config, std::string_view FunctionName, int64_t DurationMicroseconds);
+
+	// True once iSummaryIntervalSeconds have passed since the last summary (StatsMutex held)
+	bool IsSummaryDueLocked(const LogConfig& Config, std::chrono::steady_clock::time_point Now) const;
+
+	// Seal the active log file into the next numbered segment and reopen it (LogMutex held)
+	void RotateLocked(const LogConfig& Config);
+
+	// Path of sealed segment N, e.g. function_log.000003.txt
+	std::string GetSegmentPath(uint32_t Index) const;
+
+	// Pick up segments left by previous sessions: continue numbering, queue uncompressed ones
+	void ScanExistingSegments();
+
+	// Background thread: compresses sealed segments and enforces iMaxLogSegments (never
+	// deleting a segment that is still queued or being compressed)
+	void StartSegmentWorker();
+	void SegmentWorkerLoop();
+	void EnforceSegmentRetention();
+
+	// Readers take one snapshot per call and pass it down:
+	//   std::shared_ptr<const LogConfig> Snapshot = ConfigState.Get();
+	//   const LogConfig& Config = *Snapshot;
+	AtomicConfig<LogConfig> ConfigState;
+	std::string ConfigFilePath;
+	ConfigWatcher ConfigWatcherInstance;
+
+	// Per-function counters for rate limiting and summaries (reset every summary interval)
+	struct FunctionStats
+	{
+		LogConfig::RateLimit Limit;
+		uint64_t SampleCounter = 0;
+		int64_t WindowSecond = -1;
+		int WindowCount = 0;
+
+		uint64_t Calls = 0;
+		uint64_t Suppressed = 0;
+		uint64_t TimedCalls = 0;
+		int64_t MinDuration = 0;
+		int64_t MaxDuration = 0;
+		int64_t TotalDuration = 0;
+	};
+
+	// Lets FunctionStatsMap be probed with a string_view (no key allocation per call)
+	struct StringHash
+	{
+		using is_transparent = void;
+		size_t operator()(std::string_view Text) const { return std::hash<std::string_view>{}(Text); }
+	};
+
+	std::unordered_map<std::string, FunctionStats, StringHash, std::equal_to<>> FunctionStatsMap;
+	std::mutex StatsMutex;
+	std::chrono::steady_clock::time_point LastSummaryAt;
+
+	MappedLogSink LogFile;
 	std::mutex LogMutex;
+	bool bFileOutputEnabled = false;
 	bool bInitialized = false;
+
+	// Active segment bookkeeping (guarded by LogMutex)
+	uint64_t ActiveBytes = 0;
+	std::chrono::steady_clock::time_point ActiveOpenedAt;
+	uint32_t NextSegmentIndex = 1;
+
+	// Sealed segments waiting for the background worker, and the one it is compressing now
+	std::deque<std::string> PendingSegments;
+	std::string CompressingSegment;
+	std::mutex SegmentMutex;
+	std::condition_variable SegmentCondition;
+	bool bSegmentWorkerRunning = false;
+	bool bStopSegmentWorker = false;
 };
+
+template <typename NameFn>
+bool FunctionLogger::ShouldLog(const LogConfig& Config, uintptr_t FunctionKey, const NameFn& GetFunctionName)
+{
+	if (!Config.bEnableKeywordFiltering || Config.KeywordFilter.IsEmpty())
+		return true;
+
+	// The cache belongs to the snapshot, so a reload starts from an empty one
+	bool bVerdict = false;
+	if (FindVerdict(Config, FunctionKey, bVerdict))
+		return bVerdict;
+
+	bVerdict = Config.KeywordFilter.Matches(GetFunctionName());
+	StoreVerdict(Config, FunctionKey, bVerdict);
+	return bVerdict;
+}
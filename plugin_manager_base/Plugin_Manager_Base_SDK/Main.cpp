@@ -1,4 +1,5 @@
 #include <Windows.h>
+#include <algorithm>
 #include <iostream>
 #include <chrono>
 #include <thread>
@@ -21,6 +22,22 @@
 // Include our hook system
 #include "PluginAPI.h"
 
+// Parallel full GObjects dump
+#include "ObjectDump.h"
+
+// Memoized object paths
+#include "ObjectPathCache.h"
+
+// Binary GObjects snapshot
+#include "ObjectSnapshot.h"
+
+// Startup readiness probes
+#include "StartupProbe.h"
+
+// Class -> instances index and name table shared with the GUI and plugins
+#include "ClassInstanceIndex.h"
+#include "ObjectNameTable.h"
+
 // --- Forward declarations for proxy functions ---
 void load_original_dwmapi();
 void setup_proxy_functions();
@@ -29,6 +46,9 @@ void setup_proxy_functions();
 FunctionLogger* g_Logger = nullptr;
 bool bMenuOpenDetected = false;
 
+// Start times of the MenuOpen ProcessEvent calls in flight on this thread (innermost last)
+thread_local std::vector<std::chrono::steady_clock::time_point> g_MenuOpenStarts;
+
 // Typedef for FunctionLogger's OnProcessEvent export
 typedef void (*OnProcessEventFn)(const char*, const char*, void*, bool);
 
@@ -39,64 +59,35 @@ std::string Method1_GetFullName(SDK::UObject* Object)
 	return Object->GetFullName();
 }
 
+// METHODS 2-8 are assembled from ObjectPathCache segments: each object's name is resolved once
+// and shared Outer prefixes (packages, levels) are memoized, instead of walking and GetName()-ing
+// the whole chain again for every format.
+
 // METHOD 2: Traverse Outer chain manually
 std::string Method2_OuterChain(SDK::UObject* Object)
 {
 	if (!Object) return "";
-
-	std::string Path;
-	SDK::UObject* Current = Object;
-
-	while (Current)
-	{
-		std::string CurrentName = Current->GetName();
-		if (!Path.empty())
-		{
-			Path = CurrentName + "." + Path;
-		}
-		else
-		{
-			Path = CurrentName;
-		}
-		Current = Current->Outer;
-	}
-
-	return Path;
+	return ObjectPathCache::Get().GetOuterPath(Object);
 }
 
 // METHOD 3: Class + Name direct access
 std::string Method3_ClassAndName(SDK::UObject* Object)
 {
 	if (!Object) return "";
-	std::string ClassName = Object->Class ? Object->Class->GetName() : "Unknown";
-	return ClassName + " " + Object->GetName();
+	ObjectPathCache& Cache = ObjectPathCache::Get();
+	std::string ClassName = Object->Class ? Cache.GetClassName(Object) : "Unknown";
+	return ClassName + " " + Cache.GetName(Object);
 }
 
 // METHOD 4: Full outer chain with class info
 std::string Method4_OuterChainWithClass(SDK::UObject* Object)
 {
 	if (!Object) return "";
-
-	std::string Path;
-	SDK::UObject* Current = Object;
-
-	while (Current)
-	{
-		std::string CurrentName = Current->GetName();
-		if (!Path.empty())
-		{
-			Path = CurrentName + "." + Path;
-		}
-		else
-		{
-			Path = CurrentName;
-		}
-		Current = Current->Outer;
-	}
+	ObjectPathCache& Cache = ObjectPathCache::Get();
 
 	// Add class at the beginning
-	std::string ClassName = Object->Class ? Object->Class->GetName() : "Unknown";
-	return "/" + ClassName + "." + Path;
+	std::string ClassName = Object->Class ? Cache.GetClassName(Object) : "Unknown";
+	return "/" + ClassName + "." + Cache.GetOuterPath(Object);
 }
 
 // METHOD 5: Get outer chain as package path (like Unreal's default path format)
@@ -104,24 +95,8 @@ std::string Method5_PackagePath(SDK::UObject* Object)
 {
 	if (!Object) return "";
 
-	std::vector<std::string> PathParts;
-	SDK::UObject* Current = Object;
-
-	while (Current)
-	{
-		PathParts.push_back(Current->GetName());
-		Current = Current->Outer;
-	}
-
-	// Reverse to get root to leaf order
-	std::string Path;
-	for (int i = PathParts.size() - 1; i >= 0; i--)
-	{
-		if (!Path.empty()) Path += ".";
-		Path += PathParts[i];
-	}
-
-	return Path;
+	// Root to leaf order, same as Method 2
+	return ObjectPathCache::Get().GetOuterPath(Object);
 }
 
 // METHOD 6: Attempt to use FString representation (if available)
@@ -131,10 +106,9 @@ std::string Method6_StringCast(SDK::UObject* Object)
 
 	// Try to get a string representation - this simulates what Python's str() does
 	// by combining class name and full path
-	std::string ClassName = Object->Class ? Object->Class->GetName() : "Unknown";
-	std::string FullPath = Method5_PackagePath(Object);
-
-	return ClassName + " " + FullPath;
+	ObjectPathCache& Cache = ObjectPathCache::Get();
+	std::string ClassName = Object->Class ? Cache.GetClassName(Object) : "Unknown";
+	return ClassName + " " + Cache.GetOuterPath(Object);
 }
 
 // METHOD 7: Asset/Pak file path (like /OakGame/Content/Maps/World_P)
@@ -142,45 +116,8 @@ std::string Method7_AssetPath(SDK::UObject* Object)
 {
 	if (!Object) return "";
 
-	// Find the root package
-	SDK::UObject* Current = Object;
-	SDK::UObject* Package = nullptr;
-
-	while (Current)
-	{
-		// A package is an object whose outer is nullptr
-		if (!Current->Outer)
-		{
-			Package = Current;
-			break;
-		}
-		Current = Current->Outer;
-	}
-
-	if (!Package) return "";
-
-	std::string PackageName = Package->GetName();
-
-	// Get the full path from package to object
-	std::vector<std::string> PathParts;
-	Current = Object;
-
-	while (Current && Current != Package)
-	{
-		PathParts.push_back(Current->GetName());
-		Current = Current->Outer;
-	}
-
-	// Build path: /PackageName/Part1/Part2/ObjectName
-	std::string AssetPath = "/" + PackageName;
-
-	// Add all parts in reverse order (root to leaf)
-	for (int i = PathParts.size() - 1; i >= 0; i--)
-	{
-		AssetPath += "/" + PathParts[i];
-	}
-
-	return AssetPath;
+	// Build path: /PackageName/Part1/Part2/ObjectName (a package is an object whose outer is nullptr)
+	return ObjectPathCache::Get().GetAssetPath(Object);
 }
 
 // METHOD 8: Full pak-style path with class info (like /OakGame/Content/Maps/World_P.World_P_C)
@@ -193,7 +130,7 @@ std::string Method8_AssetPathWithClass(SDK::UObject* Object)
 	if (AssetPath.empty()) return "";
 
 	// Add class info at the end if it's a Blueprint or class instance
-	std::string ClassName = Object->Class ? Object->Class->GetName() : "";
+	std::string ClassName = ObjectPathCache::Get().GetClassName(Object);
 
 	if (!ClassName.empty())
 	{
@@ -231,9 +168,10 @@ void DumpUObjectArray(const std::string& FilePath)
 
 	try
 	{
-		// First pass: collect all valid object indices
+		// First pass: collect all valid object indices (bounded by the array's element count)
 		std::vector<int> ValidIndices;
-		int MaxElements = 1000000;  // Safety limit to prevent infinite loops
+		int MaxElements = SDK::UObject::GObjects->Num();
+		ValidIndices.reserve(MaxElements > 0 ? MaxElements : 0);
 
 		if (g_Logger)
 		{
@@ -416,17 +354,17 @@ DWORD WINAPI MainThread(LPVOID lpParam)
 
 		// Initialize logger FIRST so we can use it
 		FunctionLogger& Logger = FunctionLogger::Get();
-		Logger.Initialize("", DllDir);
+		// config.ini sits next to the DLL; the logger re-reads it whenever it changes on disk
+		Logger.Initialize(DllDir + "config.ini", DllDir);
 		g_Logger = &Logger;
 
 		Logger.LogDiagnostic("=== MenuOpen Logger DLL Loaded ===");
 		Logger.LogDiagnostic("DLL Directory: " + DllDir);
 
-		// Wait for game to fully initialize before scanning/hooking
-		Logger.LogDiagnostic("Waiting 2 seconds for game initialization...");
-		std::this_thread::sleep_for(std::chrono::milliseconds(2000));
+		// Each startup phase begins as soon as its precondition holds instead of after a fixed sleep
+		auto StartupBegin = std::chrono::steady_clock::now();
 
-		// Initialize SDK using offsets from Basic.hpp
+		// Initialize SDK using offsets from Basic.hpp (static addresses, valid as soon as the image is mapped)
 		Logger.LogDiagnostic("Initializing Unreal Engine SDK...");
 
 		uintptr_t base = (uintptr_t)GetModuleHandleA(nullptr);
@@ -450,10 +388,19 @@ DWORD WINAPI MainThread(LPVOID lpParam)
 		Logger.LogDiagnostic("SDK Initialization complete.");
 		Logger.LogDiagnostic("Logging MenuOpen calls to: " + DllDir + "function_log.txt");
 
-		// Wait 10 seconds before initializing the hook system
-		Logger.LogDiagnostic("Waiting 10 seconds before initializing HookSystem...");
-		std::this_thread::sleep_for(std::chrono::seconds(10));
+		// Wait for the engine to populate GObjects, the name pool and the GameEngine object
+		constexpr int32_t MinStartupObjects = 0x10000;
+		StartupProbe::Result ObjectsPhase = StartupProbe::WaitFor([]() { return StartupProbe::GObjectsPopulated(MinStartupObjects); }, std::chrono::seconds(60));
+		Logger.LogDiagnostic(StartupProbe::Describe("GObjects", ObjectsPhase));
+
+		StartupProbe::Result NamesPhase = StartupProbe::WaitFor(StartupProbe::NamePoolReady, std::chrono::seconds(30));
+		Logger.LogDiagnostic(StartupProbe::Describe("Name pool", NamesPhase));
+
+		StartupProbe::Result EnginePhase = StartupProbe::WaitFor(StartupProbe::GameEnginePresent, std::chrono::seconds(60));
+		Logger.LogDiagnostic(StartupProbe::Describe("GameEngine", EnginePhase));
+
 		Logger.LogDiagnostic("HookSystem initialization starting...");
+		auto HooksBegin = std::chrono::steady_clock::now();
 
 		// Install ProcessEvent hook and register MenuOpen callback
 		Logger.LogDiagnostic("Installing ProcessEvent hook...");
@@ -462,6 +409,16 @@ DWORD WINAPI MainThread(LPVOID lpParam)
 			Logger.LogError("Hook installation failed");
 		}
 
+		{
+			auto Now = std::chrono::steady_clock::now();
+			std::stringstream ss;
+			ss << std::fixed << std::setprecision(0)
+				<< "[Startup] Hooks installed in " << std::chrono::duration<double, std::milli>(Now - HooksBegin).count()
+				<< " ms; startup complete after " << std::chrono::duration<double, std::milli>(Now - StartupBegin).count() << " ms";
+			Logger.LogDiagnostic(ss.str());
+		}
+		StartupProbe::MarkComplete();
+
 		// Register MenuOpen callback
 		auto& HookSys = PluginAPI::GetHookSystem();
 
@@ -516,12 +473,10 @@ DWORD WINAPI MainThread(LPVOID lpParam)
 
 		// Create a pre-callback for MenuOpen detection
 		auto MenuOpenCallback = [&Logger, &DllDir](void* obj, void* func, void* params) {
-			if (bMenuOpenDetected) return;
-
 			SDK::UObject* Object = (SDK::UObject*)obj;
 			SDK::UFunction* Function = (SDK::UFunction*)func;
 
-			if (Object && Function)
+			if (!bMenuOpenDetected && Object && Function)
 			{
 				std::string FunctionName = Function->GetName();
 				std::string ClassName = Object->GetName();
@@ -536,20 +491,56 @@ DWORD WINAPI MainThread(LPVOID lpParam)
 
 					bMenuOpenDetected = true;
 
-					if (g_Logger)
-					{
-						g_Logger->LogFunctionCall(ClassName, FunctionName, (uintptr_t)Object);
-					}
-
-					// Dump GUObjectArray to file
+					// Sample dump of GUObjectArray, off the game thread like the full dump below
+					// (detached like our other background threads; it only reads GObjects)
 					char DumpPath[MAX_PATH];
 					GetTempPathA(MAX_PATH, DumpPath);
 					strcat_s(DumpPath, MAX_PATH, "uobject_dump.txt");
-					DumpUObjectArray(DumpPath);
+					std::thread([SamplePath = std::string(DumpPath)]()
+					{
+						DumpUObjectArray(SamplePath);
+						if (g_Logger)
+						{
+							g_Logger->LogDiagnostic("[MenuOpen] Dump complete! Saved to: " + SamplePath);
+						}
+					}).detach();
 
-					if (g_Logger)
+					// Optional full dump: every live object, on worker threads so the game keeps running
+					std::shared_ptr<const FunctionLogger::LogConfig> ConfigSnapshot = FunctionLogger::Get().GetConfig();
+					const FunctionLogger::LogConfig& Config = *ConfigSnapshot;
+					if (Config.bFullObjectDump)
 					{
-						g_Logger->LogDiagnostic(std::string("[MenuOpen] Dump complete! Saved to: ") + DumpPath);
+						char FullDumpPath[MAX_PATH];
+						GetTempPathA(MAX_PATH, FullDumpPath);
+						strcat_s(FullDumpPath, MAX_PATH, "uobject_full_dump.txt");
+
+						ObjectDumpOptions DumpOptions;
+						DumpOptions.iThreads = Config.iObjectDumpThreads;
+						if (ObjectDumper::Get().StartAsync(FullDumpPath, DumpOptions) && g_Logger)
+						{
+							g_Logger->LogDiagnostic(std::string("[MenuOpen] Full object dump started in the background: ") + FullDumpPath);
+						}
+					}
+
+					// Optional binary snapshot for offline queries (tools/SnapshotQuery)
+					if (Config.bObjectSnapshot)
+					{
+						char SnapshotPath[MAX_PATH];
+						GetTempPathA(MAX_PATH, SnapshotPath);
+						strcat_s(SnapshotPath, MAX_PATH, "uobject_snapshot.bos");
+
+						if (Config.iSnapshotIntervalSeconds > 0)
+						{
+							if (ObjectSnapshot::Get().StartSeries(SnapshotPath, Config.iSnapshotIntervalSeconds, Config.iObjectDumpThreads) && g_Logger)
+							{
+								g_Logger->LogDiagnostic(std::string("[MenuOpen] Object snapshot series started: ") + SnapshotPath +
+									" (delta every " + std::to_string(Config.iSnapshotIntervalSeconds) + " s)");
+							}
+						}
+						else if (ObjectSnapshot::Get().StartAsync(SnapshotPath, Config.iObjectDumpThreads) && g_Logger)
+						{
+							g_Logger->LogDiagnostic(std::string("[MenuOpen] Object snapshot started in the background: ") + SnapshotPath);
+						}
 					}
 
 					// Load Plugin_Manager.dll
@@ -574,6 +565,25 @@ DWORD WINAPI MainThread(LPVOID lpParam)
 					}
 				}
 			}
+
+			// Started last, so MenuOpenPostCallback times only the original ProcessEvent
+			g_MenuOpenStarts.push_back(std::chrono::steady_clock::now());
+		};
+
+		// Logs every MenuOpen call with the duration of its ProcessEvent
+		auto MenuOpenPostCallback = [](void* obj, void* func, void* params) {
+			if (g_MenuOpenStarts.empty()) return;
+
+			auto Duration = std::chrono::steady_clock::now() - g_MenuOpenStarts.back();
+			g_MenuOpenStarts.pop_back();
+
+			SDK::UObject* Object = (SDK::UObject*)obj;
+			SDK::UFunction* Function = (SDK::UFunction*)func;
+			if (!g_Logger || !Object || !Function) return;
+
+			// Hooked on purpose, so config.ini's Keywords don't apply; rate limiting and sampling do
+			g_Logger->LogHookedCall(Function->GetName(), Object->GetName(), (uintptr_t)Function, "", "",
+				std::chrono::duration_cast<std::chrono::microseconds>(Duration).count());
 		};
 
 		// Register the callback for MenuOpen function - retry until successful
@@ -589,7 +599,7 @@ DWORD WINAPI MainThread(LPVOID lpParam)
 			if (!bMenuOpenHookRegistered)
 			{
 				// Silently attempt to register (suppress error logging)
-				if (HookSys.RegisterHook("ui_script_menu_base_C", "MenuOpen", MenuOpenCallback, nullptr, true))
+				if (HookSys.RegisterHook("ui_script_menu_base_C", "MenuOpen", MenuOpenCallback, MenuOpenPostCallback, true))
 				{
 					Logger.LogDiagnostic("[MenuOpen] Hook successfully registered! Waiting for detection...");
 					bMenuOpenHookRegistered = true;
@@ -610,6 +620,8 @@ DWORD WINAPI MainThread(LPVOID lpParam)
 		{
 			g_Logger->LogError(std::string("EXCEPTION: ") + e.what());
 		}
+		// Startup is over either way; the GUI keeps its menu locked until this is set
+		StartupProbe::MarkComplete();
 		return -1;
 	}
 	catch (...)
@@ -618,6 +630,7 @@ DWORD WINAPI MainThread(LPVOID lpParam)
 		{
 			g_Logger->LogError("UNKNOWN EXCEPTION");
 		}
+		StartupProbe::MarkComplete();
 		return -1;
 	}
 }
@@ -641,6 +654,128 @@ extern "C" __declspec(dllexport) bool __cdecl RegisterGlobalHook(
 	return PluginAPI::HookSystem::Get().RegisterHook(ClassName, FunctionName, PreCallback, PostCallback);
 }
 
+extern "C" __declspec(dllexport) uint64_t __cdecl RegisterGlobalHookWithHandle(
+	const char* ClassName,
+	const char* FunctionName,
+	void* PreCallbackPtr,
+	void* PostCallbackPtr,
+	bool bSilent)
+{
+	PluginAPI::PreHookCallback* pPre = (PluginAPI::PreHookCallback*)PreCallbackPtr;
+	PluginAPI::PostHookCallback* pPost = (PluginAPI::PostHookCallback*)PostCallbackPtr;
+
+	PluginAPI::PreHookCallback PreCallback = pPre ? *pPre : nullptr;
+	PluginAPI::PostHookCallback PostCallback = pPost ? *pPost : nullptr;
+
+	return PluginAPI::HookSystem::Get().RegisterHookWithHandle(ClassName, FunctionName, PreCallback, PostCallback, bSilent);
+}
+
+extern "C" __declspec(dllexport) bool __cdecl UnregisterGlobalHook(uint64_t Handle)
+{
+	return PluginAPI::HookSystem::Get().UnregisterHookHandle(Handle);
+}
+
+// --- Exported startup state ---
+// True once MainThread has run every startup phase and installed the ProcessEvent hook
+extern "C" __declspec(dllexport) bool __cdecl IsStartupComplete()
+{
+	return StartupProbe::IsComplete();
+}
+
+// --- Exported object index ---
+// One ClassInstanceIndex per process; the GUI and plugins reach it through PluginAPI::ObjectIndex
+extern "C" __declspec(dllexport) size_t __cdecl GetClassInstances(
+	const SDK::UClass* Class,
+	bool bExactClassOnly,
+	SDK::UObject** OutObjects,
+	size_t Capacity)
+{
+	std::vector<SDK::UObject*> Instances;
+	ClassInstanceIndex::Get().GetInstances(Class, bExactClassOnly, Instances);
+	std::copy_n(Instances.begin(), (std::min)(Instances.size(), Capacity), OutObjects);
+	return Instances.size();
+}
+
+extern "C" __declspec(dllexport) size_t __cdecl GetIndexedClasses(const SDK::UClass** OutClasses, size_t Capacity)
+{
+	std::vector<const SDK::UClass*> Classes;
+	ClassInstanceIndex::Get().GetClasses(Classes);
+	std::copy_n(Classes.begin(), (std::min)(Classes.size(), Capacity), OutClasses);
+	return Classes.size();
+}
+
+extern "C" __declspec(dllexport) void __cdecl RefreshObjectIndex()
+{
+	ClassInstanceIndex::Get().Refresh();
+}
+
+extern "C" __declspec(dllexport) void __cdecl StartObjectIndexRefresh(uint32_t IntervalMs)
+{
+	ClassInstanceIndex::Get().StartAutoRefresh(IntervalMs);
+}
+
+extern "C" __declspec(dllexport) void __cdecl StopObjectIndexRefresh()
+{
+	ClassInstanceIndex::Get().StopAutoRefresh();
+}
+
+extern "C" __declspec(dllexport) bool __cdecl IsObjectIndexBuilt()
+{
+	return ClassInstanceIndex::Get().IsBuilt();
+}
+
+// --- Exported name table ---
+// One ObjectNameTable per process; the GUI and plugins reach it through PluginAPI::NameTable
+extern "C" __declspec(dllexport) bool __cdecl FindNameInTable(const char* Name, size_t Length, SDK::FName* OutName)
+{
+	return OutName && ObjectNameTable::Get().FindName(std::string_view(Name, Length), *OutName);
+}
+
+extern "C" __declspec(dllexport) size_t __cdecl FindObjectsByName(
+	const char* Name,
+	size_t Length,
+	SDK::UObject** OutObjects,
+	size_t Capacity)
+{
+	std::vector<SDK::UObject*> Objects;
+	ObjectNameTable::Get().FindObjects(std::string_view(Name, Length), Objects);
+	std::copy_n(Objects.begin(), (std::min)(Objects.size(), Capacity), OutObjects);
+	return Objects.size();
+}
+
+extern "C" __declspec(dllexport) size_t __cdecl GetNameTableSize()
+{
+	return ObjectNameTable::Get().GetNameCount();
+}
+
+extern "C" __declspec(dllexport) size_t __cdecl GetObjectNameSlots(ObjectNameSlot* OutSlots, size_t Capacity)
+{
+	std::vector<ObjectNameSlot> Slots;
+	ObjectNameTable::Get().GetSlots(Slots);
+	std::copy_n(Slots.begin(), (std::min)(Slots.size(), Capacity), OutSlots);
+	return Slots.size();
+}
+
+extern "C" __declspec(dllexport) void __cdecl RefreshNameTable()
+{
+	ObjectNameTable::Get().Refresh();
+}
+
+extern "C" __declspec(dllexport) void __cdecl StartNameTableRefresh(uint32_t IntervalMs)
+{
+	ObjectNameTable::Get().StartAutoRefresh(IntervalMs);
+}
+
+extern "C" __declspec(dllexport) void __cdecl StopNameTableRefresh()
+{
+	ObjectNameTable::Get().StopAutoRefresh();
+}
+
+extern "C" __declspec(dllexport) bool __cdecl IsNameTableBuilt()
+{
+	return ObjectNameTable::Get().IsBuilt();
+}
+
 // --- DLL Entry Point ---
 BOOL APIENTRY DllMain(HMODULE hModule, DWORD reason, LPVOID lpReserved)
 {
@@ -0,0 +1,277 @@
+#pragma once
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+
+/**
+* Memory-mapped append-only log file
+* The file is pre-extended and mapped; Append reserves its range with one
+* atomic add on the tail and copies into the view, so writing a line is a memcpy instead of
+* a WriteFile (+ flush) syscall. Bytes land in the OS page cache immediately, so they survive
+* a crash of the game process; Sync() additionally schedules them for disk.
+*
+* Growing means unmapping and remapping the whole file, so the mapping grows geometrically:
+* each step adds as much as is already mapped (at least one chunk, at most MaxGrowthStep).
+* A file of N bytes is remapped O(log N) times instead of N / ChunkSize times.
+*
+* While open, the file is padded with zero bytes past the tail. Close() truncates it to the
+* written size; a file left behind by a killed process simply ends in NULs.
+*
+* Off Windows the same design runs on open/ftruncate/mmap/msync, for tools/LogSinkBench.
+*/
+
+class MappedLogSink
+{
+public:
+	static constexpr uint64_t DefaultChunkSize = 8ull * 1024 * 1024;
+	static constexpr uint64_t MaxGrowthStep = 256ull * 1024 * 1024;
+
+	MappedLogSink() = default;
+	~MappedLogSink() { Close(); }
+
+	MappedLogSink(const MappedLogSink&) = delete;
+	MappedLogSink& operator=(const MappedLogSink&) = delete;
+
+	// Create/truncate Path and map the first chunk. ChunkSize is the smallest growth step.
+	bool Open(const std::string& Path, uint64_t ChunkSize = DefaultChunkSize)
+	{
+		Close();
+
+		std::unique_lock<std::shared_mutex> Lock(MapMutex);
+
+		if (!OpenFileLocked(Path))
+			return false;
+
+		Chunk = ChunkSize ? ChunkSize : DefaultChunkSize;
+		Capacity = 0;
+		Tail.store(0, std::memory_order_relaxed);
+
+		if (!RemapLocked(1))
+		{
+			CloseFileLocked();
+			return false;
+		}
+		return true;
+	}
+
+	bool IsOpen() const { return bOpen; }
+
+	// Bytes appended so far
+	uint64_t Size() const { return Tail.load(std::memory_order_relaxed); }
+
+	// Thread-safe. Concurrent appends never interleave within one call's Data.
+	bool Append(std::string_view Data)
+	{
+		if (Data.empty())
+			return true;
+
+		std::shared_lock<std::shared_mutex> Lock(MapMutex);
+		if (!View)
+			return false;
+
+		uint64_t Offset = Tail.fetch_add(Data.size(), std::memory_order_relaxed);
+		uint64_t End = Offset + Data.size();
+
+		// Capacity only changes under the exclusive lock, so it is stable while we hold the shared one
+		while (End > Capacity)
+		{
+			Lock.unlock();
+			{
+				std::unique_lock<std::shared_mutex> GrowLock(MapMutex);
+				if (View && End > Capacity)
+					RemapLocked(End);
+			}
+			Lock.lock();
+			if (!View)
+				return false;
+		}
+
+		std::memcpy(View + Offset, Data.data(), Data.size());
+		return true;
+	}
+
+	// Durability point: start writing the dirty pages back to disk (does not wait for the device)
+	void Sync()
+	{
+		std::shared_lock<std::shared_mutex> Lock(MapMutex);
+		if (!View)
+			return;
+#ifdef _WIN32
+		FlushViewOfFile(View, 0);
+#else
+		msync(View, static_cast<size_t>(Capacity), MS_ASYNC);
+#endif
+	}
+
+	// Unmap and cut the file back to the written size
+	void Close()
+	{
+		std::unique_lock<std::shared_mutex> Lock(MapMutex);
+		if (!bOpen)
+			return;
+
+		UnmapLocked();
+		TruncateFileLocked(Tail.load(std::memory_order_relaxed));
+		CloseFileLocked();
+		Capacity = 0;
+	}
+
+private:
+#ifdef _WIN32
+	bool OpenFileLocked(const std::string& Path)
+	{
+		// Share delete so the file can be renamed (segment rotation) by whoever owns it next
+		File = CreateFileA(Path.c_str(), GENERIC_READ | GENERIC_WRITE,
+			FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+			CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (File == INVALID_HANDLE_VALUE)
+		{
+			File = nullptr;
+			return false;
+		}
+		bOpen = true;
+		return true;
+	}
+
+	void TruncateFileLocked(uint64_t Size)
+	{
+		LARGE_INTEGER End;
+		End.QuadPart = static_cast<LONGLONG>(Size);
+		if (SetFilePointerEx(File, End, nullptr, FILE_BEGIN))
+			SetEndOfFile(File);
+	}
+
+	void CloseFileLocked()
+	{
+		CloseHandle(File);
+		File = nullptr;
+		bOpen = false;
+	}
+
+	void UnmapLocked()
+	{
+		if (View)
+		{
+			UnmapViewOfFile(View);
+			View = nullptr;
+		}
+		if (Mapping)
+		{
+			CloseHandle(Mapping);
+			Mapping = nullptr;
+		}
+	}
+
+	// Map NewCapacity bytes of the file, growing it first if needed (exclusive lock held, nothing mapped)
+	bool MapLocked(uint64_t NewCapacity)
+	{
+		// Creating a mapping larger than the file extends the file to that size
+		Mapping = CreateFileMappingA(File, nullptr, PAGE_READWRITE,
+			static_cast<DWORD>(NewCapacity >> 32), static_cast<DWORD>(NewCapacity & 0xFFFFFFFF), nullptr);
+		if (!Mapping)
+		{
+			OutputDebugStringA("MappedLogSink: CreateFileMapping failed, file output stopped.\n");
+			return false;
+		}
+
+		View = static_cast<char*>(MapViewOfFile(Mapping, FILE_MAP_WRITE, 0, 0, static_cast<SIZE_T>(NewCapacity)));
+		if (!View)
+		{
+			OutputDebugStringA("MappedLogSink: MapViewOfFile failed, file output stopped.\n");
+			CloseHandle(Mapping);
+			Mapping = nullptr;
+			return false;
+		}
+		return true;
+	}
+#else
+	bool OpenFileLocked(const std::string& Path)
+	{
+		File = open(Path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+		bOpen = File >= 0;
+		return bOpen;
+	}
+
+	void TruncateFileLocked(uint64_t Size)
+	{
+		// A failed truncate only leaves the zero padding in place
+		if (ftruncate(File, static_cast<off_t>(Size)) != 0)
+			return;
+	}
+
+	void CloseFileLocked()
+	{
+		close(File);
+		File = -1;
+		bOpen = false;
+	}
+
+	void UnmapLocked()
+	{
+		if (View)
+		{
+			munmap(View, static_cast<size_t>(Capacity));
+			View = nullptr;
+		}
+	}
+
+	bool MapLocked(uint64_t NewCapacity)
+	{
+		if (ftruncate(File, static_cast<off_t>(NewCapacity)) != 0)
+			return false;
+
+		void* Address = mmap(nullptr, static_cast<size_t>(NewCapacity), PROT_READ | PROT_WRITE, MAP_SHARED, File, 0);
+		if (Address == MAP_FAILED)
+			return false;
+
+		View = static_cast<char*>(Address);
+		return true;
+	}
+#endif
+
+	// Grow the file to hold MinSize bytes, by at least the current capacity (capped at
+	// MaxGrowthStep), rounded up to a chunk boundary, and map all of it (exclusive lock held)
+	bool RemapLocked(uint64_t MinSize)
+	{
+		uint64_t Step = (std::min)((std::max)(Capacity, Chunk), (std::max)(MaxGrowthStep, Chunk));
+		uint64_t Target = (std::max)(MinSize, Capacity + Step);
+		uint64_t NewCapacity = (Target + Chunk - 1) / Chunk * Chunk;
+
+		UnmapLocked();
+
+		if (!MapLocked(NewCapacity))
+		{
+			Capacity = 0;
+			return false;
+		}
+
+		Capacity = NewCapacity;
+		return true;
+	}
+
+#ifdef _WIN32
+	HANDLE File = nullptr;
+	HANDLE Mapping = nullptr;
+#else
+	int File = -1;
+#endif
+	bool bOpen = false;
+	char* View = nullptr;
+	uint64_t Capacity = 0;
+	uint64_t Chunk = DefaultChunkSize;
+	std::atomic<uint64_t> Tail{ 0 };
+	std::shared_mutex MapMutex;
+};
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "SDK/SDK/Basic.hpp"
+#include "SDK/SDK/CoreUObject_classes.hpp"
+
+/**
+* Raw access to GObjects slots
+* The SDK only exposes GetByIndex(); incremental consumers (indexes, snapshots) also need the
+* slot's serial number to tell "same object" from "slot reused by a new object". Layout is the
+* chunked FUObjectArray of this game: FUObjectItem is { Object, Flags, ClusterRootIndex,
+* SerialNumber, ... } with the serial at +0x10.
+*
+* The engine only assigns a serial the first time a weak pointer to the object is made, so a
+* serial of 0 is common; Fingerprint() therefore also mixes in the object and class pointers.
+*/
+
+namespace ObjectArray
+{
+	constexpr int32_t SerialNumberOffset = 0x10;
+
+	inline int32_t Num()
+	{
+		return SDK::UObject::GObjects->Num();
+	}
+
+	// Slot item for Index, or nullptr if the index or its chunk is not allocated
+	inline const SDK::FUObjectItem* GetItem(int32_t Index)
+	{
+		const auto* Array = SDK::UObject::GObjects.operator->();
+		if (Index < 0 || Index >= Array->NumElements)
+			return nullptr;
+
+		const int32_t ChunkIndex = Index / SDK::TUObjectArray::ElementsPerChunk;
+		if (ChunkIndex >= Array->NumChunks)
+			return nullptr;
+
+		const SDK::FUObjectItem* Chunk = Array->GetDecrytedObjPtr()[ChunkIndex];
+		if (!Chunk)
+			return nullptr;
+		return &Chunk[Index % SDK::TUObjectArray::ElementsPerChunk];
+	}
+
+	inline int32_t NumChunks()
+	{
+		const int32_t Count = Num();
+		return (Count + SDK::TUObjectArray::ElementsPerChunk - 1) / SDK::TUObjectArray::ElementsPerChunk;
+	}
+
+	// Contiguous items of one chunk, for scans that walk GObjects span by span instead of
+	// resolving every index. OutCount is the number of items below Num(); nullptr if unallocated.
+	inline const SDK::FUObjectItem* GetChunk(int32_t ChunkIndex, int32_t& OutCount)
+	{
+		OutCount = 0;
+		const auto* Array = SDK::UObject::GObjects.operator->();
+		if (ChunkIndex < 0 || ChunkIndex >= Array->NumChunks)
+			return nullptr;
+
+		const SDK::FUObjectItem* Chunk = Array->GetDecrytedObjPtr()[ChunkIndex];
+		if (!Chunk)
+			return nullptr;
+
+		const int32_t First = ChunkIndex * SDK::TUObjectArray::ElementsPerChunk;
+		OutCount = (std::min)(static_cast<int32_t>(SDK::TUObjectArray::ElementsPerChunk), Array->NumElements - First);
+		if (OutCount <= 0)
+		{
+			OutCount = 0;
+			return nullptr;
+		}
+		return Chunk;
+	}
+
+	inline int32_t GetSerialNumber(const SDK::FUObjectItem* Item)
+	{
+		int32_t Serial;
+		std::memcpy(&Serial, reinterpret_cast<const uint8_t*>(Item) + SerialNumberOffset, sizeof(Serial));
+		return Serial;
+	}
+
+	// Changes whenever the slot starts holding a different object (0 for an empty slot)
+	inline uint64_t Fingerprint(const SDK::FUObjectItem* Item)
+	{
+		if (!Item || !Item->Object)
+			return 0;
+
+		uint64_t Hash = reinterpret_cast<uintptr_t>(Item->Object);
+		Hash = (Hash ^ reinterpret_cast<uintptr_t>(Item->Object->Class)) * 0x9E3779B97F4A7C15ull;
+		Hash ^= static_cast<uint32_t>(GetSerialNumber(Item));
+		return Hash ? Hash : 1;
+	}
+
+	// Identity of an object's FName (ComparisonIndex, Number): equal keys mean equal GetName()
+	inline uint64_t NameKey(const SDK::UObject* Object)
+	{
+		return (static_cast<uint64_t>(static_cast<uint32_t>(Object->Name.ComparisonIndex)) << 32) |
+			static_cast<uint32_t>(Object->Name.Number);
+	}
+
+	// Fingerprint() that also changes when the object is renamed (0 for an empty slot)
+	inline uint64_t NamedFingerprint(const SDK::FUObjectItem* Item)
+	{
+		if (!Item || !Item->Object)
+			return 0;
+
+		uint64_t Hash = Fingerprint(Item) ^ (NameKey(Item->Object) * 0x9E3779B97F4A7C15ull);
+		return Hash ? Hash : 1;
+	}
+
+	// Weak reference to a GObjects slot: resolves to nullptr once the object is gone
+	struct ObjectHandle
+	{
+		int32_t Index = -1;
+		SDK::UObject* Object = nullptr;
+		int32_t SerialNumber = 0;
+
+		bool IsSet() const { return Index >= 0; }
+	};
+
+	inline ObjectHandle MakeHandle(const SDK::UObject* Object)
+	{
+		ObjectHandle Handle;
+		if (!Object)
+			return Handle;
+
+		const SDK::FUObjectItem* Item = GetItem(Object->Index);
+		if (!Item || Item->Object != Object)
+			return Handle;
+
+		Handle.Index = Object->Index;
+		Handle.Object = const_cast<SDK::UObject*>(Object);
+		Handle.SerialNumber = GetSerialNumber(Item);
+		return Handle;
+	}
+
+	inline SDK::UObject* Resolve(const ObjectHandle& Handle)
+	{
+		const SDK::FUObjectItem* Item = GetItem(Handle.Index);
+		if (!Item || Item->Object != Handle.Object)
+			return nullptr;
+
+		// A serial assigned after the handle was made is fine; a different one means reuse
+		if (Handle.SerialNumber != 0 && GetSerialNumber(Item) != Handle.SerialNumber)
+			return nullptr;
+		return Item->Object;
+	}
+}
@@ -0,0 +1,213 @@
+#include "ObjectDump.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <ctime>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "SDK/SDK/Basic.hpp"
+#include "SDK/SDK/CoreUObject_classes.hpp"
+
+#include "Logger.hpp"
+#include "ObjectPathCache.h"
+
+namespace
+{
+	// One finished (or pending) range, owned by the writer once bReady is set
+	struct RangeSlot
+	{
+		std::string Text;
+		int64_t Objects = 0;
+		bool bReady = false;
+	};
+
+	void FormatRange(int32_t Begin, int32_t End, std::string& Out, int64_t& Objects)
+	{
+		for (int32_t Index = Begin; Index < End; ++Index)
+		{
+			SDK::UObject* Object = SDK::UObject::GObjects->GetByIndex(Index);
+			if (!Object)
+				continue;
+
+			std::string FullName;
+			try
+			{
+				// Same format as GetFullName(), but Outer prefixes are built once per dump
+				FullName = ObjectPathCache::Get().GetFullName(Object);
+			}
+			catch (...)
+			{
+				FullName = "<unreadable>";
+			}
+
+			std::format_to(std::back_inserter(Out), "{}\t0x{:X}\t{}\n", Index, reinterpret_cast<uintptr_t>(Object), FullName);
+			++Objects;
+		}
+	}
+}
+
+bool ObjectDumper::StartAsync(const std::string& FilePath, const ObjectDumpOptions& DumpOptions)
+{
+	if (bRunning.exchange(true, std::memory_order_acq_rel))
+		return false;
+
+	// Detached like our other background threads; the dumper is a process-lifetime singleton
+	std::thread([this, FilePath, DumpOptions]()
+	{
+		RunLocked(FilePath, DumpOptions);
+		bRunning.store(false, std::memory_order_release);
+	}).detach();
+	return true;
+}
+
+bool ObjectDumper::Run(const std::string& FilePath, const ObjectDumpOptions& DumpOptions)
+{
+	if (bRunning.exchange(true, std::memory_order_acq_rel))
+		return false;
+
+	bool bResult = RunLocked(FilePath, DumpOptions);
+	bRunning.store(false, std::memory_order_release);
+	return bResult;
+}
+
+float ObjectDumper::GetProgress() const
+{
+	int32_t Total = TotalSlots.load(std::memory_order_relaxed);
+	if (Total <= 0)
+		return 0.0f;
+	return static_cast<float>(ProcessedSlots.load(std::memory_order_relaxed)) / static_cast<float>(Total);
+}
+
+bool ObjectDumper::RunLocked(const std::string& FilePath, const ObjectDumpOptions& DumpOptions)
+{
+	FunctionLogger& Logger = FunctionLogger::Get();
+	auto StartTime = std::chrono::steady_clock::now();
+
+	ProcessedSlots.store(0, std::memory_order_relaxed);
+	ObjectsWritten.store(0, std::memory_order_relaxed);
+
+	// Slots added after this point are not part of the dump
+	const int32_t Total = SDK::UObject::GObjects->Num();
+	TotalSlots.store(Total, std::memory_order_relaxed);
+	if (Total <= 0)
+	{
+		Logger.LogError("[DUMP] GObjects is empty or not initialized, full dump skipped");
+		return false;
+	}
+
+	std::ofstream DumpFile(FilePath, std::ios::binary | std::ios::trunc);
+	if (!DumpFile.is_open())
+	{
+		Logger.LogError("[DUMP] Failed to open full dump file: " + FilePath);
+		return false;
+	}
+
+	const int32_t RangeSize = (std::max)(DumpOptions.iRangeSize, 256);
+	const int32_t RangeCount = (Total + RangeSize - 1) / RangeSize;
+	const int ThreadCount = DumpOptions.iThreads > 0 ? DumpOptions.iThreads :
+		(std::max)(1, static_cast<int>(std::thread::hardware_concurrency()) / 2);
+	const int32_t Window = DumpOptions.iMaxRangesInFlight > 0 ? DumpOptions.iMaxRangesInFlight : 2 * ThreadCount;
+
+	Logger.LogDiagnostic(std::format("[DUMP] Full dump of {} slots ({} ranges, {} workers) to {}",
+		Total, RangeCount, ThreadCount, FilePath));
+
+	DumpFile << "=== GUObjectArray Full Dump ===\n";
+	DumpFile << "Timestamp: " << std::time(nullptr) << "\n";
+	DumpFile << "Slots: " << Total << "\n";
+	DumpFile << "Index\tAddress\tFullName\n\n";
+
+	// Slots[Range % Window] holds Range until the writer takes it
+	std::vector<RangeSlot> Slots(Window);
+	std::mutex SlotMutex;
+	std::condition_variable SlotFree;
+	std::condition_variable SlotReady;
+	int32_t NextToWrite = 0;
+	std::atomic<int32_t> NextRange{ 0 };
+
+	auto Worker = [&]()
+	{
+		std::string Buffer;
+		while (true)
+		{
+			int32_t Range = NextRange.fetch_add(1, std::memory_order_relaxed);
+			if (Range >= RangeCount)
+				break;
+
+			// Backpressure: don't get more than Window ranges ahead of the writer
+			{
+				std::unique_lock<std::mutex> Lock(SlotMutex);
+				SlotFree.wait(Lock, [&]() { return Range < NextToWrite + Window; });
+			}
+
+			int32_t Begin = Range * RangeSize;
+			int32_t End = (std::min)(Total, Begin + RangeSize);
+			int64_t Objects = 0;
+			FormatRange(Begin, End, Buffer, Objects);
+			ProcessedSlots.fetch_add(End - Begin, std::memory_order_relaxed);
+
+			{
+				// Hand the text over and take back the slot's old (empty) buffer and its capacity
+				std::lock_guard<std::mutex> Lock(SlotMutex);
+				RangeSlot& Slot = Slots[Range % Window];
+				Slot.Text.swap(Buffer);
+				Slot.Objects = Objects;
+				Slot.bReady = true;
+			}
+			SlotReady.notify_one();
+			Buffer.clear();
+		}
+	};
+
+	std::vector<std::thread> Workers;
+	Workers.reserve(ThreadCount);
+	for (int i = 0; i < ThreadCount; ++i)
+		Workers.emplace_back(Worker);
+
+	// Writer: emit ranges in order, report progress every 10%
+	std::string Chunk;
+	int NextReport = 10;
+	for (int32_t Range = 0; Range < RangeCount; ++Range)
+	{
+		int64_t Objects = 0;
+		{
+			std::unique_lock<std::mutex> Lock(SlotMutex);
+			RangeSlot& Slot = Slots[Range % Window];
+			SlotReady.wait(Lock, [&]() { return Slot.bReady; });
+			Chunk.swap(Slot.Text);
+			Objects = Slot.Objects;
+			Slot.bReady = false;
+			++NextToWrite;
+		}
+		SlotFree.notify_all();
+
+		DumpFile.write(Chunk.data(), static_cast<std::streamsize>(Chunk.size()));
+		Chunk.clear();
+		ObjectsWritten.fetch_add(Objects, std::memory_order_relaxed);
+
+		int Percent = static_cast<int>(100ll * (Range + 1) / RangeCount);
+		if (Percent >= NextReport && Range + 1 < RangeCount)
+		{
+			Logger.LogDiagnostic(std::format("[DUMP] {}% ({} objects written)", Percent, ObjectsWritten.load(std::memory_order_relaxed)));
+			NextReport = Percent / 10 * 10 + 10;
+		}
+	}
+
+	for (std::thread& Thread : Workers)
+		Thread.join();
+
+	int64_t Written = ObjectsWritten.load(std::memory_order_relaxed);
+	DumpFile << "\n=== Summary ===\n";
+	DumpFile << "Slots scanned: " << Total << "\n";
+	DumpFile << "Live objects: " << Written << "\n";
+	DumpFile.close();
+
+	auto ElapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - StartTime).count();
+	Logger.LogDiagnostic(std::format("[DUMP] Full dump complete: {} objects in {} ms", Written, ElapsedMs));
+	return !DumpFile.fail();
+}
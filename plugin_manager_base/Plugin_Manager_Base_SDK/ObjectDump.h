@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+/**
+* Parallel, streaming GObjects dump
+* The object array is split into fixed ranges of slots that a small pool of workers claims in
+* index order. Each worker formats its range into its own buffer; the writer emits finished
+* ranges strictly in order, so the file reads exactly like a serial dump. Workers never get
+* more than MaxRangesInFlight ranges ahead of the writer, which bounds memory to a few ranges
+* of text no matter how many objects there are.
+*
+* The dump reads GObjects while the game keeps running (that is the point: it never blocks the
+* game thread), so objects created or destroyed during the dump may or may not appear in it.
+*
+* Record format, one line per live object:
+*   <Index>\t0x<Address>\t<Class> <Outer...>.<Name>
+*/
+
+struct ObjectDumpOptions
+{
+	int iThreads = 0;              // 0 = half the hardware threads, at least 1
+	int32_t iRangeSize = 0x4000;   // slots per work item; divides a GObjects chunk (0x10000)
+	int iMaxRangesInFlight = 0;    // 0 = 2 per worker
+};
+
+class ObjectDumper
+{
+public:
+	static ObjectDumper& Get()
+	{
+		static ObjectDumper Instance;
+		return Instance;
+	}
+
+	// Dump on a background thread. Returns false if a dump is already running.
+	bool StartAsync(const std::string& FilePath, const ObjectDumpOptions& DumpOptions = ObjectDumpOptions());
+
+	// Dump on the calling thread (plus workers). Returns false if a dump is already running
+	// or the file could not be written.
+	bool Run(const std::string& FilePath, const ObjectDumpOptions& DumpOptions = ObjectDumpOptions());
+
+	bool IsRunning() const { return bRunning.load(std::memory_order_acquire); }
+
+	// Fraction of GObjects slots processed by the current (or last) dump, 0..1
+	float GetProgress() const;
+
+	// Live objects written by the current (or last) dump
+	int64_t GetObjectsWritten() const { return ObjectsWritten.load(std::memory_order_relaxed); }
+
+private:
+	ObjectDumper() = default;
+	ObjectDumper(const ObjectDumper&) = delete;
+	ObjectDumper& operator=(const ObjectDumper&) = delete;
+
+	bool RunLocked(const std::string& FilePath, const ObjectDumpOptions& DumpOptions);
+
+	std::atomic<bool> bRunning{ false };
+	std::atomic<int32_t> ProcessedSlots{ 0 };
+	std::atomic<int32_t> TotalSlots{ 0 };
+	std::atomic<int64_t> ObjectsWritten{ 0 };
+};
@@ -0,0 +1,242 @@
+#include "ObjectNameTable.h"
+
+#include <algorithm>
+
+namespace
+{
+	char ToLower(char C)
+	{
+		return (C >= 'A' && C <= 'Z') ? static_cast<char>(C - 'A' + 'a') : C;
+	}
+
+	// FNV-1a over the lowercased name: FName comparison is case-insensitive
+	uint64_t HashName(std::string_view Name)
+	{
+		uint64_t Hash = 0xCBF29CE484222325ull;
+		for (char C : Name)
+			Hash = (Hash ^ static_cast<uint8_t>(ToLower(C))) * 0x100000001B3ull;
+		return Hash;
+	}
+
+	bool EqualsIgnoreCase(std::string_view A, std::string_view B)
+	{
+		if (A.size() != B.size())
+			return false;
+		for (size_t i = 0; i < A.size(); ++i)
+		{
+			if (ToLower(A[i]) != ToLower(B[i]))
+				return false;
+		}
+		return true;
+	}
+}
+
+void ObjectNameTable::Refresh()
+{
+	std::lock_guard<std::mutex> RefreshLock(RefreshMutex);
+
+	struct Change
+	{
+		int32_t Index;
+		SDK::UObject* Object;
+		uint64_t NameKey;
+	};
+	std::vector<Change> Changes;
+	std::unordered_map<uint64_t, SDK::FName> NewNames;
+
+	// EntryByKey is only written under RefreshMutex, which we hold
+	Mirror.Update([&](int32_t Index, const SDK::FUObjectItem* Item) {
+		SDK::UObject* Object = Item ? Item->Object : nullptr;
+		const uint64_t Key = Object ? ObjectArray::NameKey(Object) : 0;
+		Changes.push_back({ Index, Object, Key });
+		if (Object && EntryByKey.find(Key) == EntryByKey.end())
+			NewNames.try_emplace(Key, Object->Name);
+	});
+
+	// The expensive part, without blocking lookups
+	std::vector<std::pair<uint64_t, std::string>> Resolved;
+	Resolved.reserve(NewNames.size());
+	for (const auto& [Key, Name] : NewNames)
+	{
+		try
+		{
+			Resolved.emplace_back(Key, Name.ToString());
+		}
+		catch (...)
+		{
+			Resolved.emplace_back(Key, std::string());
+		}
+	}
+
+	std::unique_lock<std::shared_mutex> Lock(Mutex);
+	for (auto& [Key, Text] : Resolved)
+		AddEntryLocked(Key, NewNames[Key], std::move(Text));
+	if (static_cast<int32_t>(Slots.size()) < Mirror.Size())
+		Slots.resize(Mirror.Size());
+	for (const Change& Changed : Changes)
+	{
+		RemoveLocked(Changed.Index);
+		Slot NewSlot;
+		NewSlot.Object = Changed.Object;
+		if (Changed.Object)
+			NewSlot.Entry = EntryByKey[Changed.NameKey];
+		InsertLocked(Changed.Index, NewSlot);
+	}
+	bBuilt.store(true, std::memory_order_release);
+}
+
+void ObjectNameTable::StartAutoRefresh(uint32_t IntervalMs)
+{
+	Refresher.Start([this]() { Refresh(); }, IntervalMs);
+}
+
+void ObjectNameTable::StopAutoRefresh()
+{
+	Refresher.Stop();
+}
+
+size_t ObjectNameTable::GetNameCount() const
+{
+	std::shared_lock<std::shared_mutex> Lock(Mutex);
+	return Entries.size();
+}
+
+bool ObjectNameTable::FindName(std::string_view Name, SDK::FName& OutName)
+{
+	EnsureBuilt();
+
+	std::shared_lock<std::shared_mutex> Lock(Mutex);
+	const uint32_t EntryIndex = FindEntryLocked(Name);
+	if (EntryIndex == NoEntry)
+		return false;
+	OutName = Entries[EntryIndex].FName;
+	return true;
+}
+
+void ObjectNameTable::FindObjects(std::string_view Name, std::vector<SDK::UObject*>& Out)
+{
+	EnsureBuilt();
+
+	std::shared_lock<std::shared_mutex> Lock(Mutex);
+	const uint32_t EntryIndex = FindEntryLocked(Name);
+	if (EntryIndex == NoEntry)
+		return;
+
+	for (int32_t Index : Entries[EntryIndex].Objects)
+	{
+		// The slot may have changed since the last refresh
+		const SDK::FUObjectItem* Item = ObjectArray::GetItem(Index);
+		if (Item && Item->Object == Slots[Index].Object)
+			Out.push_back(Item->Object);
+	}
+}
+
+void ObjectNameTable::GetSlots(std::vector<ObjectNameSlot>& Out)
+{
+	EnsureBuilt();
+
+	std::shared_lock<std::shared_mutex> Lock(Mutex);
+	Out.resize(Slots.size());
+	for (size_t i = 0; i < Slots.size(); ++i)
+	{
+		const Slot& Current = Slots[i];
+		Out[i].Object = Current.Object;
+		Out[i].Name = Current.Entry != NoEntry ? Entries[Current.Entry].Name.data() : nullptr;
+	}
+}
+
+void ObjectNameTable::EnsureBuilt()
+{
+	// Builds once; concurrent callers wait for that build instead of repeating it
+	if (!bBuilt.load(std::memory_order_acquire))
+		Refresh();
+}
+
+// Linear probe (shared or exclusive lock held)
+uint32_t ObjectNameTable::FindEntryLocked(std::string_view Name) const
+{
+	if (Buckets.empty())
+		return NoEntry;
+
+	const uint64_t Hash = HashName(Name);
+	const size_t Mask = Buckets.size() - 1;
+	for (size_t i = static_cast<size_t>(Hash) & Mask;; i = (i + 1) & Mask)
+	{
+		const uint32_t Bucket = Buckets[i];
+		if (Bucket == 0)
+			return NoEntry;
+
+		const Entry& Candidate = Entries[Bucket - 1];
+		if (Candidate.Hash == Hash && EqualsIgnoreCase(Candidate.Name, Name))
+			return Bucket - 1;
+	}
+}
+
+void ObjectNameTable::InsertBucketLocked(uint32_t EntryIndex)
+{
+	const size_t Mask = Buckets.size() - 1;
+	size_t i = static_cast<size_t>(Entries[EntryIndex].Hash) & Mask;
+	while (Buckets[i] != 0)
+		i = (i + 1) & Mask;
+	Buckets[i] = EntryIndex + 1;
+}
+
+// Exclusive lock held
+void ObjectNameTable::AddEntryLocked(uint64_t Key, const SDK::FName& FName, std::string Name)
+{
+	// Different FNames can print the same (case variants); the first one keeps the string
+	const uint32_t Existing = FindEntryLocked(Name);
+	if (Existing != NoEntry)
+	{
+		EntryByKey[Key] = Existing;
+		return;
+	}
+
+	const uint32_t EntryIndex = static_cast<uint32_t>(Entries.size());
+	Names.push_back(std::move(Name));
+	Entry NewEntry;
+	NewEntry.Name = Names.back();
+	NewEntry.Hash = HashName(NewEntry.Name);
+	NewEntry.FName = FName;
+	Entries.push_back(std::move(NewEntry));
+	EntryByKey[Key] = EntryIndex;
+
+	// Keep the load factor at or below one half
+	if (Entries.size() * 2 > Buckets.size())
+	{
+		Buckets.assign((std::max<size_t>)(1024, Buckets.size() * 2), 0);
+		for (uint32_t i = 0; i < Entries.size(); ++i)
+			InsertBucketLocked(i);
+	}
+	else
+	{
+		InsertBucketLocked(EntryIndex);
+	}
+}
+
+// Swap-remove the slot's object from its name's list (exclusive lock held)
+void ObjectNameTable::RemoveLocked(int32_t Index)
+{
+	Slot& Current = Slots[Index];
+	if (Current.Entry != NoEntry)
+	{
+		std::vector<int32_t>& List = Entries[Current.Entry].Objects;
+		const int32_t Moved = List.back();
+		List[Current.Position] = Moved;
+		Slots[Moved].Position = Current.Position;
+		List.pop_back();
+	}
+	Current = Slot();
+}
+
+// Exclusive lock held
+void ObjectNameTable::InsertLocked(int32_t Index, const Slot& NewSlot)
+{
+	Slots[Index] = NewSlot;
+	if (NewSlot.Entry == NoEntry)
+		return;
+
+	std::vector<int32_t>& List = Entries[NewSlot.Entry].Objects;
+	Slots[Index].Position = static_cast<int32_t>(List.size());
+	List.push_back(Index);
+}
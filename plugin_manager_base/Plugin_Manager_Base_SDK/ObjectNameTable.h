@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "ObjectSlotMirror.h"
+#include "PluginAPI.h"
+
+/**
+* String -> FName / objects lookup table
+* Every distinct name in GObjects is resolved through AppendString once and interned in an
+* open-addressing hash table (case-insensitive, like FName comparison), together with the live
+* objects carrying that name. Looking an object or class up by name is then one hash probe plus
+* the objects of that name, instead of a GetName() call per object in GObjects.
+*
+* Kept current by ObjectSlotMirror passes, like ClassInstanceIndex: only slots whose object or
+* name changed touch the table, and only names never seen before are resolved. The engine never
+* frees pool names either, so entries are never removed and their strings never move; a name
+* without live objects just resolves to no objects.
+*
+* One instance per process, owned by this DLL and exported through PluginAPI.h
+* (PluginAPI::NameTable wraps it). Results are copied out under the lock.
+*
+* The table is harvested from object names because the SDK exposes no name-pool iteration;
+* names not used by any live object (e.g. function parameter names) are not in it.
+*/
+
+class ObjectNameTable
+{
+public:
+	static ObjectNameTable& Get()
+	{
+		static ObjectNameTable Instance;
+		return Instance;
+	}
+
+	// Apply everything that changed in GObjects since the last refresh (builds on first call)
+	void Refresh();
+
+	// Refresh on a background thread every IntervalMs; StopAutoRefresh joins that thread
+	void StartAutoRefresh(uint32_t IntervalMs = 2000);
+	void StopAutoRefresh();
+
+	bool IsBuilt() const { return bBuilt.load(std::memory_order_acquire); }
+
+	size_t GetNameCount() const;
+
+	// FName for a name string (including any _N number suffix); false if no object uses it
+	bool FindName(std::string_view Name, SDK::FName& OutName);
+
+	// Appends the live objects named Name to Out
+	void FindObjects(std::string_view Name, std::vector<SDK::UObject*>& Out);
+
+	// Every GObjects slot as of the last refresh: its object and that object's name (nullptr
+	// for an empty slot). The strings are the table's own and stay valid for the process lifetime.
+	void GetSlots(std::vector<ObjectNameSlot>& Out);
+
+private:
+	static constexpr uint32_t NoEntry = UINT32_MAX;
+
+	struct Entry
+	{
+		std::string_view Name;          // into Names
+		SDK::FName FName;
+		uint64_t Hash = 0;
+		std::vector<int32_t> Objects;   // GObjects indices
+	};
+
+	struct Slot
+	{
+		SDK::UObject* Object = nullptr;
+		uint32_t Entry = NoEntry;
+		int32_t Position = -1;          // index in Entries[Entry].Objects
+	};
+
+	ObjectNameTable() : Refresher("ObjectNameTable") {}
+	ObjectNameTable(const ObjectNameTable&) = delete;
+	ObjectNameTable& operator=(const ObjectNameTable&) = delete;
+
+	void EnsureBuilt();
+	uint32_t FindEntryLocked(std::string_view Name) const;
+	void InsertBucketLocked(uint32_t EntryIndex);
+	void AddEntryLocked(uint64_t Key, const SDK::FName& FName, std::string Name);
+	void RemoveLocked(int32_t Index);
+	void InsertLocked(int32_t Index, const Slot& NewSlot);
+
+	std::vector<Entry> Entries;
+	std::deque<std::string> Names;                      // stable storage for Entry::Name
+	std::vector<uint32_t> Buckets;                      // entry + 1, 0 = empty
+	std::vector<Slot> Slots;
+	std::unordered_map<uint64_t, uint32_t> EntryByKey;  // FName (ComparisonIndex, Number) -> entry
+	mutable std::shared_mutex Mutex;                    // guards the containers above
+	std::mutex RefreshMutex;                            // one refresh at a time; guards Mirror
+	ObjectSlotMirror Mirror;
+	RefreshThread Refresher;
+	std::atomic<bool> bBuilt{ false };
+};
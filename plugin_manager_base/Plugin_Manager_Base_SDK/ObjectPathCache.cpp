@@ -0,0 +1,322 @@
+#include "ObjectPathCache.h"
+
+#include <algorithm>
+#include <mutex>
+
+#include "ObjectArray.h"
+
+namespace
+{
+	// Outer chains are a handful of links; anything deeper is a corrupt (cyclic) chain
+	constexpr size_t MaxOuterDepth = 64;
+
+	// Objects that aren't (or are no longer) in GObjects can't be keyed; walk them directly
+	std::string UncachedPath(SDK::UObject* Object, char Separator, bool bLeadingSeparator)
+	{
+		std::string Path;
+		size_t Depth = 0;
+		for (SDK::UObject* Current = Object; Current && Depth < MaxOuterDepth; Current = Current->Outer, ++Depth)
+			Path = Path.empty() ? Current->GetName() : Current->GetName() + Separator + Path;
+		return bLeadingSeparator ? Separator + Path : Path;
+	}
+}
+
+std::string ObjectPathCache::GetName(SDK::UObject* Object)
+{
+	if (!Object)
+		return "";
+
+	int32_t NodeId = Resolve(Object);
+	if (NodeId < 0)
+		return Object->GetName();
+
+	std::shared_lock<std::shared_mutex> Lock(Mutex);
+	return Names[Nodes[NodeId].NameId];
+}
+
+std::string ObjectPathCache::GetClassName(SDK::UObject* Object)
+{
+	if (!Object || !Object->Class)
+		return "";
+	return GetName(Object->Class);
+}
+
+std::string ObjectPathCache::GetOuterPath(SDK::UObject* Object)
+{
+	return BuildPath(Object, PathKind::Outer);
+}
+
+std::string ObjectPathCache::GetAssetPath(SDK::UObject* Object)
+{
+	return BuildPath(Object, PathKind::Asset);
+}
+
+std::string ObjectPathCache::GetFullName(SDK::UObject* Object)
+{
+	if (!Object)
+		return "";
+	if (!Object->Class)
+		return "None";
+
+	std::string FullName = GetClassName(Object);
+	FullName += ' ';
+	FullName += GetOuterPath(Object);
+	return FullName;
+}
+
+void ObjectPathCache::Clear()
+{
+	std::unique_lock<std::shared_mutex> Lock(Mutex);
+	Nodes.clear();
+	IndexToNode.clear();
+	Names.clear();
+	NameIds.clear();
+}
+
+size_t ObjectPathCache::GetNodeCount() const
+{
+	std::shared_lock<std::shared_mutex> Lock(Mutex);
+	return Nodes.size();
+}
+
+int32_t ObjectPathCache::Resolve(SDK::UObject* Object)
+{
+	// Part of the Outer chain that isn't cached yet, leaf first
+	struct PendingNode
+	{
+		SDK::UObject* Object;
+		uint64_t NameKey;
+		std::string Name;
+		bool bNeedsName;
+	};
+	std::vector<PendingNode> Pending;
+
+	{
+		// The whole chain is checked: a renamed or reparented Outer invalidates the memoized
+		// paths of everything below it, so those nodes are rebuilt along with it
+		std::shared_lock<std::shared_mutex> Lock(Mutex);
+		SDK::UObject* Chain[MaxOuterDepth];
+		size_t ChainLength = 0;
+		size_t StaleLength = 0;
+		int32_t LeafNode = -1;
+		for (SDK::UObject* Current = Object; Current && ChainLength < MaxOuterDepth; Current = Current->Outer)
+		{
+			int32_t NodeId = FindLocked(Current);
+			if (Current == Object)
+				LeafNode = NodeId;
+			Chain[ChainLength++] = Current;
+			if (NodeId < 0)
+				StaleLength = ChainLength;
+		}
+		if (StaleLength == 0)
+			return LeafNode;
+
+		for (size_t i = 0; i < StaleLength; ++i)
+		{
+			uint64_t NameKey = ObjectArray::NameKey(Chain[i]);
+			Pending.push_back({ Chain[i], NameKey, {}, NameIds.find(NameKey) == NameIds.end() });
+		}
+	}
+
+	// GetName() is the expensive part; resolve new names without holding the lock
+	for (PendingNode& Node : Pending)
+	{
+		if (Node.bNeedsName)
+			Node.Name = Node.Object->GetName();
+	}
+
+	std::unique_lock<std::shared_mutex> Lock(Mutex);
+	int32_t NodeId = -1;
+	for (auto It = Pending.rbegin(); It != Pending.rend(); ++It)
+	{
+		// Another thread may have inserted it in the meantime (a rebuilt parent fails its children)
+		NodeId = FindLocked(It->Object);
+		if (NodeId >= 0)
+			continue;
+
+		uint32_t NameId;
+		auto Found = NameIds.find(It->NameKey);
+		if (Found != NameIds.end())
+		{
+			NameId = Found->second;
+		}
+		else
+		{
+			// Only without a prefetched name if a Clear() raced us
+			if (!It->bNeedsName)
+				It->Name = It->Object->GetName();
+			NameId = static_cast<uint32_t>(Names.size());
+			Names.push_back(std::move(It->Name));
+			NameIds.emplace(It->NameKey, NameId);
+		}
+
+		// An Outer that can't be cached (no longer in GObjects) would turn this node into a root
+		// and drop the Outer from its path; leave it and everything below it uncached
+		int32_t Parent = -1;
+		if (It->Object->Outer)
+		{
+			Parent = FindLocked(It->Object->Outer);
+			if (Parent < 0)
+				return -1;
+		}
+		NodeId = InsertLocked(It->Object, NameId, Parent);
+		if (NodeId < 0)
+			return -1;
+	}
+	return NodeId;
+}
+
+int32_t ObjectPathCache::FindLocked(SDK::UObject* Object) const
+{
+	const int32_t Index = Object->Index;
+	if (Index < 0 || Index >= static_cast<int32_t>(IndexToNode.size()))
+		return -1;
+
+	const int32_t NodeId = IndexToNode[Index];
+	if (NodeId < 0)
+		return -1;
+
+	const Node& Entry = Nodes[NodeId];
+	if (Entry.Object != Object || Entry.Class != Object->Class)
+		return -1;
+
+	// Renamed or reparented in place (or reused at the same address with a serial of 0)
+	if (Entry.NameKey != ObjectArray::NameKey(Object) || Entry.Outer != Object->Outer)
+		return -1;
+
+	// The parent node must still describe this Outer, as it was when this node was built
+	if (Entry.Parent >= 0)
+	{
+		const Node& Parent = Nodes[Entry.Parent];
+		if (Parent.Object != Entry.Outer || Parent.Generation != Entry.ParentGeneration)
+			return -1;
+	}
+
+	const SDK::FUObjectItem* Item = ObjectArray::GetItem(Index);
+	if (!Item || Item->Object != Object)
+		return -1;
+
+	// Same rule as ObjectArray::Resolve: a serial assigned since is fine, a different one is reuse
+	if (Entry.SerialNumber != 0 && ObjectArray::GetSerialNumber(Item) != Entry.SerialNumber)
+		return -1;
+	return NodeId;
+}
+
+int32_t ObjectPathCache::InsertLocked(SDK::UObject* Object, uint32_t NameId, int32_t Parent)
+{
+	const int32_t Index = Object->Index;
+	const SDK::FUObjectItem* Item = ObjectArray::GetItem(Index);
+	if (!Item || Item->Object != Object)
+		return -1;
+
+	if (Index >= static_cast<int32_t>(IndexToNode.size()))
+		IndexToNode.resize((std::max)(static_cast<size_t>(Index) + 1, static_cast<size_t>(ObjectArray::Num())), -1);
+
+	// A reused slot is rebuilt in place; anything still pointing at the old object is stale too
+	int32_t NodeId = IndexToNode[Index];
+	if (NodeId < 0)
+	{
+		NodeId = static_cast<int32_t>(Nodes.size());
+		Nodes.emplace_back();
+		IndexToNode[Index] = NodeId;
+	}
+
+	Node& Entry = Nodes[NodeId];
+	const uint32_t Generation = Entry.Generation + 1;
+	Entry = Node();
+	Entry.Object = Object;
+	Entry.Class = Object->Class;
+	Entry.SerialNumber = ObjectArray::GetSerialNumber(Item);
+	Entry.NameKey = ObjectArray::NameKey(Object);
+	Entry.Outer = Object->Outer;
+	Entry.Parent = Parent;
+	Entry.ParentGeneration = Parent >= 0 ? Nodes[Parent].Generation : 0;
+	Entry.Generation = Generation;
+	Entry.NameId = NameId;
+	return NodeId;
+}
+
+bool ObjectPathCache::HasMemoizedPrefixLocked(int32_t NodeId, PathKind Kind) const
+{
+	const Node& Entry = Nodes[NodeId];
+	if (Entry.Parent < 0)
+		return true;
+
+	const Node& Parent = Nodes[Entry.Parent];
+	return !(Kind == PathKind::Outer ? Parent.OuterPath : Parent.AssetPath).empty();
+}
+
+void ObjectPathCache::AppendPathLocked(int32_t NodeId, PathKind Kind, std::string& Out) const
+{
+	const Node& Entry = Nodes[NodeId];
+	const std::string& Memo = Kind == PathKind::Outer ? Entry.OuterPath : Entry.AssetPath;
+	if (!Memo.empty())
+	{
+		Out += Memo;
+		return;
+	}
+
+	const char Separator = Kind == PathKind::Outer ? '.' : '/';
+	if (Entry.Parent >= 0)
+	{
+		AppendPathLocked(Entry.Parent, Kind, Out);
+		Out += Separator;
+	}
+	else if (Kind == PathKind::Asset)
+	{
+		Out += Separator;
+	}
+	Out += Names[Entry.NameId];
+}
+
+const std::string& ObjectPathCache::MaterializeLocked(int32_t NodeId, PathKind Kind)
+{
+	Node& Entry = Nodes[NodeId];
+	std::string& Memo = Kind == PathKind::Outer ? Entry.OuterPath : Entry.AssetPath;
+	if (Memo.empty())
+	{
+		if (Entry.Parent >= 0)
+			MaterializeLocked(Entry.Parent, Kind);
+
+		std::string Path;
+		AppendPathLocked(NodeId, Kind, Path);
+		Memo = std::move(Path);
+	}
+	return Memo;
+}
+
+std::string ObjectPathCache::BuildPath(SDK::UObject* Object, PathKind Kind)
+{
+	if (!Object)
+		return "";
+
+	const bool bAsset = Kind == PathKind::Asset;
+	int32_t NodeId = Resolve(Object);
+	if (NodeId < 0)
+		return UncachedPath(Object, bAsset ? '/' : '.', bAsset);
+
+	std::string Path;
+	{
+		// Common case: the Outer's path is already memoized, so this is one append
+		std::shared_lock<std::shared_mutex> Lock(Mutex);
+		if (FindLocked(Object) == NodeId && HasMemoizedPrefixLocked(NodeId, Kind))
+		{
+			AppendPathLocked(NodeId, Kind, Path);
+			return Path;
+		}
+	}
+
+	std::unique_lock<std::shared_mutex> Lock(Mutex);
+	NodeId = FindLocked(Object);
+	if (NodeId < 0)
+	{
+		Lock.unlock();
+		return UncachedPath(Object, bAsset ? '/' : '.', bAsset);
+	}
+
+	// Memoize the Outer chain (shared by everything inside it), but not the leaf itself
+	if (Nodes[NodeId].Parent >= 0)
+		MaterializeLocked(Nodes[NodeId].Parent, Kind);
+	AppendPathLocked(NodeId, Kind, Path);
+	return Path;
+}
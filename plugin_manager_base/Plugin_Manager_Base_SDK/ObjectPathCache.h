@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace SDK
+{
+	class UObject;
+}
+
+/**
+* Memoized object paths
+* Every object seen is stored once as a node: its Outer link (another node) and its name,
+* interned per FName so a name shared by thousands of objects is resolved by GetName() once.
+* All path formats are then assembled from cached segments; the dotted and asset paths of
+* objects that are Outers of others are memoized too, so a package or level prefix is built
+* once and reused by everything inside it.
+*
+* Nodes are keyed by GObjects index and validated against the slot's object pointer, serial
+* number, FName and Outer, and against their parent node, so a reused slot or a renamed or
+* reparented object (or anything inside one) is rebuilt instead of returning a stale path.
+* Thread-safe; names are resolved outside the lock, so parallel dump workers don't serialize.
+*/
+
+class ObjectPathCache
+{
+public:
+	static ObjectPathCache& Get()
+	{
+		static ObjectPathCache Instance;
+		return Instance;
+	}
+
+	// Object's own name
+	std::string GetName(SDK::UObject* Object);
+
+	// Name of Object's class, or "" without a class
+	std::string GetClassName(SDK::UObject* Object);
+
+	// Root.Outer.Name (the Outer chain from the package down, '.' separated)
+	std::string GetOuterPath(SDK::UObject* Object);
+
+	// /Package/Outer/Name
+	std::string GetAssetPath(SDK::UObject* Object);
+
+	// "Class Root.Outer.Name", same format as UObject::GetFullName()
+	std::string GetFullName(SDK::UObject* Object);
+
+	// Drop everything (e.g. after a level change made most entries stale)
+	void Clear();
+
+	size_t GetNodeCount() const;
+
+private:
+	ObjectPathCache() = default;
+	ObjectPathCache(const ObjectPathCache&) = delete;
+	ObjectPathCache& operator=(const ObjectPathCache&) = delete;
+
+	struct Node
+	{
+		SDK::UObject* Object = nullptr;
+		const void* Class = nullptr;
+		int32_t SerialNumber = 0;
+		uint64_t NameKey = 0;       // ObjectArray::NameKey(Object) when the node was built
+		SDK::UObject* Outer = nullptr;
+		int32_t Parent = -1;        // node of Object->Outer, -1 for a package
+		uint32_t ParentGeneration = 0;
+		uint32_t Generation = 0;    // bumped whenever the node is rebuilt
+		uint32_t NameId = 0;
+		std::string OuterPath;      // memoized once the node is used as an Outer
+		std::string AssetPath;
+	};
+
+	enum class PathKind { Outer, Asset };
+
+	int32_t Resolve(SDK::UObject* Object);
+	int32_t FindLocked(SDK::UObject* Object) const;
+	void AppendPathLocked(int32_t NodeId, PathKind Kind, std::string& Out) const;
+	bool HasMemoizedPrefixLocked(int32_t NodeId, PathKind Kind) const;
+	const std::string& MaterializeLocked(int32_t NodeId, PathKind Kind);
+	int32_t InsertLocked(SDK::UObject* Object, uint32_t NameId, int32_t Parent);
+	std::string BuildPath(SDK::UObject* Object, PathKind Kind);
+
+	std::vector<Node> Nodes;
+	std::vector<int32_t> IndexToNode;                  // GObjects index -> node, -1 if none
+	std::deque<std::string> Names;
+	std::unordered_map<uint64_t, uint32_t> NameIds;    // FName (ComparisonIndex, Number) -> Names
+	mutable std::shared_mutex Mutex;
+};
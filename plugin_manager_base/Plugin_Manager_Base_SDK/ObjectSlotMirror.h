@@ -0,0 +1,158 @@
+#pragma once
+
+#include <Windows.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "ObjectArray.h"
+
+/**
+* Incremental GObjects mirror shared by the lookup indexes
+* ObjectSlotMirror keeps one fingerprint per slot (object, class, serial and FName) and, on
+* each pass, hands the slots that changed since the previous pass to the index that owns it,
+* walking GObjects chunk by chunk. An index then only touches what changed; a pass over an
+* unchanged GObjects reads one item per slot and calls nothing.
+*
+* RefreshThread runs such a pass periodically on its own thread. Unlike a detached loop it can
+* be stopped: Stop() wakes the thread and joins it, so nothing keeps running once its owner is
+* shut down.
+*/
+
+class ObjectSlotMirror
+{
+public:
+	// Calls OnChanged(Index, Item) for every slot whose fingerprint differs from the last pass
+	// (every slot on the first pass) and records the new fingerprints. Item is nullptr or holds
+	// no object for a slot that is empty now. Returns the number of changed slots.
+	template <typename Callback>
+	size_t Update(Callback&& OnChanged)
+	{
+		const int32_t Count = ObjectArray::Num();
+		const int32_t Known = static_cast<int32_t>(Fingerprints.size());
+		if (Known < Count)
+			Fingerprints.resize(Count, 0);
+
+		const int32_t PerChunk = SDK::TUObjectArray::ElementsPerChunk;
+		size_t Changed = 0;
+		for (int32_t First = 0; First < Count; First += PerChunk)
+		{
+			int32_t ChunkCount = 0;
+			const SDK::FUObjectItem* Items = ObjectArray::GetChunk(First / PerChunk, ChunkCount);
+			const int32_t End = (std::min)(Count, First + PerChunk);
+			for (int32_t i = First; i < End; ++i)
+			{
+				const SDK::FUObjectItem* Item = (Items && i - First < ChunkCount) ? &Items[i - First] : nullptr;
+				const uint64_t Fingerprint = ObjectArray::NamedFingerprint(Item);
+				if (i < Known && Fingerprints[i] == Fingerprint)
+					continue;
+
+				Fingerprints[i] = Fingerprint;
+				OnChanged(i, Item);
+				++Changed;
+			}
+		}
+		return Changed;
+	}
+
+	// Take fingerprints gathered by a full (e.g. parallel) build as the last pass
+	void Assign(std::vector<uint64_t> Built) { Fingerprints = std::move(Built); }
+
+	void Reset() { Fingerprints.clear(); }
+
+	int32_t Size() const { return static_cast<int32_t>(Fingerprints.size()); }
+
+private:
+	std::vector<uint64_t> Fingerprints;
+};
+
+class RefreshThread
+{
+public:
+	explicit RefreshThread(const char* Name) : Name(Name) {}
+
+	// Stop() should have run by now; at process exit the thread is already gone, and joining
+	// under the loader lock during a FreeLibrary would deadlock, so it is only signaled here
+	~RefreshThread()
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		++Generation;
+		Wake.notify_all();
+		if (Thread.joinable())
+			Thread.detach();
+	}
+
+	RefreshThread(const RefreshThread&) = delete;
+	RefreshThread& operator=(const RefreshThread&) = delete;
+
+	// Run Work now and then every IntervalMs until Stop(). While running, another Start only
+	// changes the interval.
+	void Start(std::function<void()> Work, uint32_t IntervalMs)
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		this->IntervalMs = IntervalMs;
+		if (Thread.joinable())
+			return;
+
+		Thread = std::thread([this, Work = std::move(Work), RunGeneration = Generation]() { Run(Work, RunGeneration); });
+	}
+
+	// Wake the thread and wait for the pass in progress to finish. Not from DllMain.
+	void Stop()
+	{
+		std::thread Worker;
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			++Generation;
+			Worker = std::move(Thread);
+		}
+		Wake.notify_all();
+
+		if (!Worker.joinable())
+			return;
+		if (Worker.get_id() == std::this_thread::get_id())
+			Worker.detach();    // stopped from inside Work; the loop ends after this pass
+		else
+			Worker.join();
+	}
+
+	bool IsRunning() const
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		return Thread.joinable();
+	}
+
+private:
+	void Run(const std::function<void()>& Work, uint64_t RunGeneration)
+	{
+		std::unique_lock<std::mutex> Lock(Mutex);
+		while (Generation == RunGeneration)
+		{
+			Lock.unlock();
+			try
+			{
+				Work();
+			}
+			catch (...)
+			{
+				OutputDebugStringA(("[" + Name + "] Exception during refresh\n").c_str());
+			}
+			Lock.lock();
+			Wake.wait_for(Lock, std::chrono::milliseconds(IntervalMs), [&]() { return Generation != RunGeneration; });
+		}
+	}
+
+	std::string Name;
+	std::thread Thread;
+	mutable std::mutex Mutex;
+	std::condition_variable Wake;
+	uint64_t Generation = 0;    // bumped by Stop(); a loop runs while it still sees its own
+	uint32_t IntervalMs = 2000;
+};
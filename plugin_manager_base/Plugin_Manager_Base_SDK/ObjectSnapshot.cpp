@@ -0,0 +1,391 @@
+#include "ObjectSnapshot.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <format>
+#include <fstream>
+#include <thread>
+#include <unordered_map>
+
+#include "SDK/SDK/Basic.hpp"
+#include "SDK/SDK/CoreUObject_classes.hpp"
+
+#include "Logger.hpp"
+#include "ObjectArray.h"
+#include "ObjectSnapshotFormat.h"
+
+namespace
+{
+	// Slots per change-detection chunk
+	constexpr int32_t ChunkSize = 4096;
+
+	// One worker's contiguous slice of the snapshot, already in column layout
+	struct SnapshotPart
+	{
+		std::vector<int32_t> Index;
+		std::vector<int32_t> Class;
+		std::vector<int32_t> Outer;
+		std::vector<uint64_t> NameKey;
+		std::vector<uint32_t> Name;
+		std::vector<uint32_t> Flags;
+		std::vector<uint64_t> Address;
+		std::vector<int32_t> Removed;
+
+		// Distinct FNames seen, resolved to strings once after all parts are read
+		std::unordered_map<uint64_t, SDK::FName> Names;
+
+		int32_t ChunksSkipped = 0;
+	};
+
+	uint64_t MixHash(uint64_t Hash, uint64_t Value)
+	{
+		return (Hash ^ Value) * 0x9E3779B97F4A7C15ull;
+	}
+
+	template <typename Work>
+	void RunParallel(int Threads, Work&& Worker)
+	{
+		std::vector<std::thread> Workers;
+		Workers.reserve(Threads);
+		for (int t = 0; t < Threads; ++t)
+			Workers.emplace_back([&Worker, t]() { Worker(t); });
+		for (std::thread& Thread : Workers)
+			Thread.join();
+	}
+
+	uint64_t NewSnapshotId()
+	{
+		static std::atomic<uint64_t> Counter{ 0 };
+		uint64_t Now = static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
+		return MixHash(Now, Counter.fetch_add(1) + 1) | 1;
+	}
+}
+
+bool ObjectSnapshot::StartAsync(const std::string& FilePath, int Threads, bool bDelta)
+{
+	if (bRunning.exchange(true, std::memory_order_acq_rel))
+		return false;
+
+	// Detached like our other background threads; the exporter is a process-lifetime singleton
+	std::thread([this, FilePath, Threads, bDelta]()
+	{
+		RunLocked(FilePath, Threads, bDelta, false);
+		bRunning.store(false, std::memory_order_release);
+	}).detach();
+	return true;
+}
+
+bool ObjectSnapshot::Run(const std::string& FilePath, int Threads, bool bDelta)
+{
+	if (bRunning.exchange(true, std::memory_order_acq_rel))
+		return false;
+
+	bool bResult = RunLocked(FilePath, Threads, bDelta, false) != RunResult::Failed;
+	bRunning.store(false, std::memory_order_release);
+	return bResult;
+}
+
+bool ObjectSnapshot::StartSeries(const std::string& FilePath, int IntervalSeconds, int Threads)
+{
+	if (bSeriesRunning.exchange(true, std::memory_order_acq_rel))
+		return false;
+
+	std::string Stem = FilePath;
+	std::string Extension = ObjectSnapshotFormat::FileExtension;
+	if (Stem.size() > Extension.size() && Stem.compare(Stem.size() - Extension.size(), Extension.size(), Extension) == 0)
+		Stem.resize(Stem.size() - Extension.size());
+
+	std::thread([this, FilePath, Stem, Extension, IntervalSeconds, Threads]()
+	{
+		int Sequence = 0;
+		while (bSeriesRunning.load(std::memory_order_acquire))
+		{
+			// A manual export in progress just delays this one to the next interval
+			if (!bRunning.exchange(true, std::memory_order_acq_rel))
+			{
+				if (Sequence == 0)
+				{
+					if (RunLocked(FilePath, Threads, false, false) == RunResult::Written)
+						Sequence = 1;
+				}
+				else
+				{
+					std::string DeltaPath = std::format("{}.{:04}{}", Stem, Sequence, Extension);
+					if (RunLocked(DeltaPath, Threads, true, true) == RunResult::Written)
+						++Sequence;
+				}
+				bRunning.store(false, std::memory_order_release);
+			}
+			std::this_thread::sleep_for(std::chrono::seconds((std::max)(IntervalSeconds, 1)));
+		}
+	}).detach();
+	return true;
+}
+
+ObjectSnapshot::RunResult ObjectSnapshot::RunLocked(const std::string& FilePath, int Threads, bool bDelta, bool bSkipUnchanged)
+{
+	using namespace ObjectSnapshotFormat;
+
+	FunctionLogger& Logger = FunctionLogger::Get();
+	auto StartTime = std::chrono::steady_clock::now();
+	ObjectCount.store(0, std::memory_order_relaxed);
+
+	const int64_t Timestamp = static_cast<int64_t>(std::time(nullptr));
+	const int32_t Total = ObjectArray::Num();
+	if (Total <= 0)
+	{
+		Logger.LogError("[SNAPSHOT] GObjects is empty or not initialized, snapshot skipped");
+		return RunResult::Failed;
+	}
+
+	bDelta = bDelta && BaseId != 0;
+	const int ThreadCount = Threads > 0 ? Threads : (std::max)(1, static_cast<int>(std::thread::hardware_concurrency()) / 2);
+	const int32_t ChunkCount = (Total + ChunkSize - 1) / ChunkSize;
+	const int32_t BaseCount = static_cast<int32_t>(BaseSlots.size());
+
+	// Pass 1: each worker owns a contiguous run of chunks, so the parts concatenate in index order.
+	// Every slot's identity and flags are read and hashed per chunk; for a delta, a chunk whose hash matches
+	// the base is skipped without comparing or emitting anything.
+	std::vector<SnapshotPart> Parts(ThreadCount);
+	std::vector<SlotState> Slots((std::max)(Total, BaseCount));
+	std::vector<uint64_t> ChunkHashes(ChunkCount, 0);
+	const int32_t ChunksPerWorker = (ChunkCount + ThreadCount - 1) / ThreadCount;
+
+	RunParallel(ThreadCount, [&](int t)
+	{
+		SnapshotPart& Part = Parts[t];
+		const int32_t FirstChunk = t * ChunksPerWorker;
+		const int32_t LastChunk = (std::min)(ChunkCount, FirstChunk + ChunksPerWorker);
+
+		for (int32_t Chunk = FirstChunk; Chunk < LastChunk; ++Chunk)
+		{
+			const int32_t Begin = Chunk * ChunkSize;
+			const int32_t End = (std::min)(Total, Begin + ChunkSize);
+
+			uint64_t Hash = 0;
+			for (int32_t Index = Begin; Index < End; ++Index)
+			{
+				const SDK::FUObjectItem* Item = ObjectArray::GetItem(Index);
+				SDK::UObject* Object = Item ? Item->Object : nullptr;
+				SlotState& State = Slots[Index];
+				if (Object)
+				{
+					State.Object = Object;
+					State.Class = Object->Class ? Object->Class->Index : NoIndex;
+					State.Outer = Object->Outer ? Object->Outer->Index : NoIndex;
+					State.NameKey = ObjectArray::NameKey(Object);
+					State.Flags = static_cast<uint32_t>(Object->Flags);
+				}
+				Hash = MixHash(Hash, reinterpret_cast<uintptr_t>(State.Object));
+				Hash = MixHash(Hash, (static_cast<uint64_t>(static_cast<uint32_t>(State.Class)) << 32) | static_cast<uint32_t>(State.Outer));
+				Hash = MixHash(Hash, State.NameKey);
+				Hash = MixHash(Hash, State.Flags);
+			}
+			ChunkHashes[Chunk] = Hash;
+
+			if (bDelta && Chunk < static_cast<int32_t>(BaseChunkHashes.size()) && BaseChunkHashes[Chunk] == Hash)
+			{
+				++Part.ChunksSkipped;
+				continue;
+			}
+
+			for (int32_t Index = Begin; Index < End; ++Index)
+			{
+				const SlotState& State = Slots[Index];
+				const SlotState* Before = (bDelta && Index < BaseCount) ? &BaseSlots[Index] : nullptr;
+
+				if (!State.Object)
+				{
+					if (Before && Before->Object)
+						Part.Removed.push_back(Index);
+					continue;
+				}
+
+				// Same object, class, Outer, name and flags as in the base: not part of the delta. The serial
+				// number is left out on purpose, it changes whenever a first weak pointer is made.
+				if (bDelta && Before && Before->Object == State.Object && Before->Class == State.Class &&
+					Before->Outer == State.Outer && Before->NameKey == State.NameKey && Before->Flags == State.Flags)
+					continue;
+
+				SDK::UObject* Object = State.Object;
+				Part.Index.push_back(Index);
+				Part.Class.push_back(State.Class);
+				Part.Outer.push_back(State.Outer);
+				Part.NameKey.push_back(State.NameKey);
+				Part.Flags.push_back(State.Flags);
+				Part.Address.push_back(reinterpret_cast<uintptr_t>(Object));
+				Part.Names.try_emplace(State.NameKey, Object->Name);
+			}
+		}
+	});
+
+	// Base slots past the current end of GObjects are gone too (the array never shrinks in
+	// practice, but a delta must still be exact)
+	std::vector<int32_t> RemovedTail;
+	if (bDelta)
+	{
+		for (int32_t Index = Total; Index < BaseCount; ++Index)
+		{
+			if (BaseSlots[Index].Object)
+				RemovedTail.push_back(Index);
+		}
+	}
+	Slots.resize(Total);
+
+	size_t Objects = 0;
+	size_t RemovedCount = RemovedTail.size();
+	int32_t ChunksSkipped = 0;
+	for (const SnapshotPart& Part : Parts)
+	{
+		Objects += Part.Index.size();
+		RemovedCount += Part.Removed.size();
+		ChunksSkipped += Part.ChunksSkipped;
+	}
+
+	if (bDelta && bSkipUnchanged && Objects == 0 && RemovedCount == 0)
+		return RunResult::Unchanged;
+
+	// Pass 2: one id per distinct FName, strings resolved in parallel
+	std::unordered_map<uint64_t, uint32_t> NameIds;
+	std::vector<const SDK::FName*> NameValues;
+	for (SnapshotPart& Part : Parts)
+	{
+		for (const auto& [Key, Name] : Part.Names)
+		{
+			if (NameIds.try_emplace(Key, static_cast<uint32_t>(NameValues.size())).second)
+				NameValues.push_back(&Name);
+		}
+	}
+
+	std::vector<std::string> NameStrings(NameValues.size());
+	RunParallel(ThreadCount, [&](int t)
+	{
+		for (size_t i = t; i < NameValues.size(); i += ThreadCount)
+		{
+			try
+			{
+				NameStrings[i] = NameValues[i]->ToString();
+			}
+			catch (...)
+			{
+				NameStrings[i] = "<unreadable>";
+			}
+		}
+	});
+
+	RunParallel(ThreadCount, [&](int t)
+	{
+		SnapshotPart& Part = Parts[t];
+		Part.Name.resize(Part.NameKey.size());
+		for (size_t i = 0; i < Part.NameKey.size(); ++i)
+			Part.Name[i] = NameIds.find(Part.NameKey[i])->second;
+	});
+
+	// Layout: header, 64-byte aligned columns, removed indices, name offsets, name data
+	FileHeader Header{};
+	std::memcpy(Header.Magic, FileMagic, sizeof(FileMagic));
+	Header.Version = FileVersion;
+	Header.Timestamp = Timestamp;
+	Header.ObjectCount = static_cast<uint32_t>(Objects);
+	Header.NameCount = static_cast<uint32_t>(NameStrings.size());
+	Header.Kind = bDelta ? KindDelta : KindFull;
+	Header.RemovedCount = static_cast<uint32_t>(RemovedCount);
+	Header.SnapshotId = NewSnapshotId();
+	Header.BaseId = bDelta ? BaseId : 0;
+
+	uint64_t Offset = AlignUp(sizeof(FileHeader));
+	for (uint32_t c = 0; c < ColumnCount; ++c)
+	{
+		Header.ColumnOffsets[c] = Offset;
+		Offset = AlignUp(Offset + Objects * ColumnElementSize[c]);
+	}
+	Header.RemovedOffset = Offset;
+	Offset = AlignUp(Offset + RemovedCount * sizeof(int32_t));
+
+	std::vector<uint32_t> NameOffsets;
+	NameOffsets.reserve(NameStrings.size() + 1);
+	uint64_t NameDataSize = 0;
+	for (const std::string& Name : NameStrings)
+	{
+		NameOffsets.push_back(static_cast<uint32_t>(NameDataSize));
+		NameDataSize += Name.size();
+	}
+	NameOffsets.push_back(static_cast<uint32_t>(NameDataSize));
+
+	Header.NameOffsetsOffset = Offset;
+	Header.NameDataOffset = AlignUp(Offset + NameOffsets.size() * sizeof(uint32_t));
+	Header.NameDataSize = NameDataSize;
+	Header.FileSize = Header.NameDataOffset + NameDataSize;
+
+	std::ofstream File(FilePath, std::ios::binary | std::ios::trunc);
+	if (!File.is_open())
+	{
+		Logger.LogError("[SNAPSHOT] Failed to open snapshot file: " + FilePath);
+		return RunResult::Failed;
+	}
+
+	uint64_t Written = 0;
+	auto Write = [&](const void* Data, size_t Size)
+	{
+		File.write(static_cast<const char*>(Data), static_cast<std::streamsize>(Size));
+		Written += Size;
+	};
+	auto PadTo = [&](uint64_t Target)
+	{
+		static const char Zeros[ColumnAlignment] = {};
+		while (Written < Target)
+			Write(Zeros, static_cast<size_t>((std::min)(Target - Written, ColumnAlignment)));
+	};
+	auto WriteColumn = [&](uint64_t ColumnOffset, auto Member)
+	{
+		PadTo(ColumnOffset);
+		for (const SnapshotPart& Part : Parts)
+		{
+			const auto& Values = Part.*Member;
+			Write(Values.data(), Values.size() * sizeof(Values[0]));
+		}
+	};
+
+	Write(&Header, sizeof(Header));
+	WriteColumn(Header.ColumnOffsets[ColumnIndex], &SnapshotPart::Index);
+	WriteColumn(Header.ColumnOffsets[ColumnClass], &SnapshotPart::Class);
+	WriteColumn(Header.ColumnOffsets[ColumnOuter], &SnapshotPart::Outer);
+	WriteColumn(Header.ColumnOffsets[ColumnName], &SnapshotPart::Name);
+	WriteColumn(Header.ColumnOffsets[ColumnFlags], &SnapshotPart::Flags);
+	WriteColumn(Header.ColumnOffsets[ColumnAddress], &SnapshotPart::Address);
+	WriteColumn(Header.RemovedOffset, &SnapshotPart::Removed);
+	Write(RemovedTail.data(), RemovedTail.size() * sizeof(int32_t));
+	PadTo(Header.NameOffsetsOffset);
+	Write(NameOffsets.data(), NameOffsets.size() * sizeof(uint32_t));
+	PadTo(Header.NameDataOffset);
+	for (const std::string& Name : NameStrings)
+		Write(Name.data(), Name.size());
+	File.close();
+
+	if (File.fail())
+	{
+		Logger.LogError("[SNAPSHOT] Failed to write snapshot file: " + FilePath);
+		return RunResult::Failed;
+	}
+
+	// The next delta is relative to what this file describes
+	BaseSlots = std::move(Slots);
+	BaseChunkHashes = std::move(ChunkHashes);
+	BaseId = Header.SnapshotId;
+
+	ObjectCount.store(static_cast<int64_t>(Objects), std::memory_order_relaxed);
+	auto ElapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - StartTime).count();
+	if (bDelta)
+	{
+		Logger.LogDiagnostic(std::format("[SNAPSHOT] Delta: {} changed, {} removed ({} of {} chunks unchanged), {} KB in {} ms: {}",
+			Objects, RemovedCount, ChunksSkipped, ChunkCount, Header.FileSize / 1024, ElapsedMs, FilePath));
+	}
+	else
+	{
+		Logger.LogDiagnostic(std::format("[SNAPSHOT] {} objects, {} names, {} KB in {} ms: {}",
+			Objects, NameStrings.size(), Header.FileSize / 1024, ElapsedMs, FilePath));
+	}
+	return RunResult::Written;
+}
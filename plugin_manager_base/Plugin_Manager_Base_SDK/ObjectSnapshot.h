@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SDK
+{
+	class UObject;
+}
+
+/**
+* Binary GObjects snapshot exporter
+* Writes every live object to a columnar .bos file (see ObjectSnapshotFormat.h) for offline
+* analysis with tools/SnapshotQuery. Only raw fields are read per object; names are resolved
+* once per distinct FName instead of once per object, so an export takes a fraction of the
+* time of the text dump and the file is a fraction of its size.
+*
+* After a snapshot, the exporter keeps each slot's identity (object, class, outer, name), its
+* flags and a hash per 4096-slot chunk. A delta snapshot rehashes the chunks and only compares
+* slots in chunks whose hash changed, then writes just the objects created, replaced, renamed,
+* reparented or reflagged and the indices of those destroyed. That is cheap enough to run every few seconds
+* (StartSeries); SnapshotQuery merge rebuilds the full table at any delta of the chain.
+*
+* Like ObjectDumper, this reads GObjects while the game keeps running; objects created or
+* destroyed during the export may or may not be in the snapshot.
+*/
+
+class ObjectSnapshot
+{
+public:
+	static ObjectSnapshot& Get()
+	{
+		static ObjectSnapshot Instance;
+		return Instance;
+	}
+
+	// Export on a background thread. Returns false if an export is already running.
+	// bDelta writes only the changes since the previous snapshot (a full one if there is none).
+	bool StartAsync(const std::string& FilePath, int Threads = 0, bool bDelta = false);
+
+	// Export on the calling thread (plus workers). Threads 0 = half the hardware threads.
+	bool Run(const std::string& FilePath, int Threads = 0, bool bDelta = false);
+
+	// Full snapshot to FilePath, then a delta every IntervalSeconds to <FilePath stem>.<N>.bos
+	// (skipped while nothing changed). Returns false if an export or series is already running.
+	bool StartSeries(const std::string& FilePath, int IntervalSeconds, int Threads = 0);
+	void StopSeries() { bSeriesRunning.store(false, std::memory_order_release); }
+
+	bool IsRunning() const { return bRunning.load(std::memory_order_acquire); }
+
+	// Objects in the current (or last) snapshot; for a delta, the objects it records as changed
+	int64_t GetObjectCount() const { return ObjectCount.load(std::memory_order_relaxed); }
+
+private:
+	ObjectSnapshot() = default;
+	ObjectSnapshot(const ObjectSnapshot&) = delete;
+	ObjectSnapshot& operator=(const ObjectSnapshot&) = delete;
+
+	// Identity of one GObjects slot at the last snapshot
+	struct SlotState
+	{
+		SDK::UObject* Object = nullptr;
+		int32_t Class = -1;
+		int32_t Outer = -1;
+		uint64_t NameKey = 0;
+		uint32_t Flags = 0;
+	};
+
+	enum class RunResult { Failed, Written, Unchanged };
+
+	RunResult RunLocked(const std::string& FilePath, int Threads, bool bDelta, bool bSkipUnchanged);
+
+	std::atomic<bool> bRunning{ false };
+	std::atomic<bool> bSeriesRunning{ false };
+	std::atomic<int64_t> ObjectCount{ 0 };
+
+	// Base for the next delta; only touched by the export holding bRunning
+	std::vector<SlotState> BaseSlots;
+	std::vector<uint64_t> BaseChunkHashes;
+	uint64_t BaseId = 0;
+};
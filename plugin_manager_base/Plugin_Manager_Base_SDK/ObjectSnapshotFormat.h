@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+* Columnar GObjects snapshot file (.bos)
+* Shared by the in-game exporter and the offline query tool, so no Windows or SDK headers.
+*
+* One row per live object, rows in ascending GObjects index order. Each column is a packed
+* little-endian array of ObjectCount elements starting at a 64-byte aligned offset, so a
+* mapped file can be scanned in place:
+*   Index    int32   GObjects index
+*   Class    int32   GObjects index of the object's class, NoIndex if none
+*   Outer    int32   GObjects index of the object's Outer, NoIndex for packages
+*   Name     uint32  id into the name table
+*   Flags    uint32  EObjectFlags
+*   Address  uint64  object address in the game process
+*
+* Name table: uint32 offsets[NameCount + 1] into the name data, name i is the (unterminated)
+* bytes [offsets[i], offsets[i + 1]). Names are FName strings including the _N number suffix.
+*
+* Delta snapshots (Kind == KindDelta, version 2) use the same layout for the objects that were
+* created, replaced, renamed or reparented since the snapshot BaseId, plus a Removed column of
+* int32 GObjects indices whose object is gone. Applying a chain of deltas to the full snapshot
+* it starts from reconstructs the object table at the time of the last delta.
+* Version 1 files predate the fields after FileSize and are always full snapshots.
+*/
+
+namespace ObjectSnapshotFormat
+{
+	constexpr char FileMagic[4] = { 'B', 'L', 'O', 'S' };
+	constexpr uint32_t FileVersion = 2;
+	constexpr const char* FileExtension = ".bos";
+	constexpr uint64_t ColumnAlignment = 64;
+	constexpr int32_t NoIndex = -1;
+
+	enum Column : uint32_t
+	{
+		ColumnIndex,
+		ColumnClass,
+		ColumnOuter,
+		ColumnName,
+		ColumnFlags,
+		ColumnAddress,
+		ColumnCount
+	};
+
+	constexpr uint32_t ColumnElementSize[ColumnCount] = { 4, 4, 4, 4, 4, 8 };
+
+	enum SnapshotKind : uint32_t
+	{
+		KindFull,
+		KindDelta
+	};
+
+	constexpr size_t FileHeaderV1Size = 104;
+
+	struct FileHeader
+	{
+		char Magic[4];
+		uint32_t Version;
+		int64_t Timestamp;                      // time() when the export started
+		uint32_t ObjectCount;
+		uint32_t NameCount;
+		uint64_t ColumnOffsets[ColumnCount];
+		uint64_t NameOffsetsOffset;
+		uint64_t NameDataOffset;
+		uint64_t NameDataSize;
+		uint64_t FileSize;
+
+		// Version 2
+		uint32_t Kind;                          // SnapshotKind
+		uint32_t RemovedCount;                  // delta only
+		uint64_t RemovedOffset;                 // int32[RemovedCount], ascending
+		uint64_t SnapshotId;                    // unique per export
+		uint64_t BaseId;                        // delta: SnapshotId it applies to
+	};
+	static_assert(sizeof(FileHeader) == 136, "FileHeader layout is part of the file format");
+
+	constexpr uint64_t AlignUp(uint64_t Value)
+	{
+		return (Value + ColumnAlignment - 1) & ~(ColumnAlignment - 1);
+	}
+}
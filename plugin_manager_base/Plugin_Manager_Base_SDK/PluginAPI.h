@@ -1,7 +1,17 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 #include "HookSystem.h"
 
+namespace SDK {
+class UObject;
+class UClass;
+class FName;
+}
+
 namespace PluginAPI {
 
 inline HookSystem& GetHookSystem() {
@@ -9,18 +19,86 @@ inline HookSystem& GetHookSystem() {
 }
 
 }  // namespace PluginAPI
+
+// A GObjects slot as seen by the name table
+struct ObjectNameSlot {
+    SDK::UObject* Object;
+    const char* Name;
+};
+
 #ifdef BUILDING_PLUGIN_LOADER_BASE
-extern "C" __declspec(dllexport) bool __cdecl RegisterGlobalHook(
+#define PLUGIN_LOADER_BASE_API extern "C" __declspec(dllexport)
+#else
+#define PLUGIN_LOADER_BASE_API extern "C" __declspec(dllimport)
+#endif
+
+PLUGIN_LOADER_BASE_API bool __cdecl RegisterGlobalHook(
     const char* ClassName,
     const char* FunctionName,
     void* PreCallbackPtr,
     void* PostCallbackPtr
 );
-#else
-extern "C" __declspec(dllimport) bool __cdecl RegisterGlobalHook(
+// Like RegisterGlobalHook, but returns a handle (0 on failure) that UnregisterGlobalHook takes
+// to remove just these callbacks, leaving other plugins' hooks on the same function in place.
+// bSilent suppresses the registration log lines (for callers that retry).
+PLUGIN_LOADER_BASE_API uint64_t __cdecl RegisterGlobalHookWithHandle(
     const char* ClassName,
     const char* FunctionName,
     void* PreCallbackPtr,
-    void* PostCallbackPtr
+    void* PostCallbackPtr,
+    bool bSilent
 );
-#endif
+PLUGIN_LOADER_BASE_API bool __cdecl UnregisterGlobalHook(uint64_t Handle);
+PLUGIN_LOADER_BASE_API bool __cdecl IsStartupComplete();
+
+// Class -> instances index (ClassInstanceIndex), one per process.
+// The lookups copy up to Capacity results into the caller's buffer and return how many there
+// are in total; PluginAPI::CopyOut below retries with a larger buffer when they didn't fit.
+PLUGIN_LOADER_BASE_API size_t __cdecl GetClassInstances(
+    const SDK::UClass* Class,
+    bool bExactClassOnly,
+    SDK::UObject** OutObjects,
+    size_t Capacity
+);
+PLUGIN_LOADER_BASE_API size_t __cdecl GetIndexedClasses(const SDK::UClass** OutClasses, size_t Capacity);
+PLUGIN_LOADER_BASE_API void __cdecl RefreshObjectIndex();
+PLUGIN_LOADER_BASE_API void __cdecl StartObjectIndexRefresh(uint32_t IntervalMs);
+PLUGIN_LOADER_BASE_API void __cdecl StopObjectIndexRefresh();
+PLUGIN_LOADER_BASE_API bool __cdecl IsObjectIndexBuilt();
+
+// String -> FName / objects table (ObjectNameTable), one per process; same buffer convention.
+// Names are matched case-insensitively and are not null-terminated (pointer + length).
+PLUGIN_LOADER_BASE_API bool __cdecl FindNameInTable(const char* Name, size_t Length, SDK::FName* OutName);
+PLUGIN_LOADER_BASE_API size_t __cdecl FindObjectsByName(
+    const char* Name,
+    size_t Length,
+    SDK::UObject** OutObjects,
+    size_t Capacity
+);
+PLUGIN_LOADER_BASE_API size_t __cdecl GetNameTableSize();
+// One entry per GObjects slot as of the last refresh (Name is nullptr for an empty slot, and
+// the string stays valid for the whole session)
+PLUGIN_LOADER_BASE_API size_t __cdecl GetObjectNameSlots(ObjectNameSlot* OutSlots, size_t Capacity);
+PLUGIN_LOADER_BASE_API void __cdecl RefreshNameTable();
+PLUGIN_LOADER_BASE_API void __cdecl StartNameTableRefresh(uint32_t IntervalMs);
+PLUGIN_LOADER_BASE_API void __cdecl StopNameTableRefresh();
+PLUGIN_LOADER_BASE_API bool __cdecl IsNameTableBuilt();
+
+namespace PluginAPI {
+
+// Runs one of the exported lookups (fill(buffer, capacity) -> total) until out holds every
+// result. Uses out's existing capacity first, so a vector reused across calls rarely retries.
+template <typename T, typename Fill>
+void CopyOut(std::vector<T>& out, Fill&& fill) {
+    out.resize(out.capacity() > 256 ? out.capacity() : 256);
+    for (;;) {
+        size_t total = fill(out.data(), out.size());
+        if (total <= out.size()) {
+            out.resize(total);
+            return;
+        }
+        out.resize(total + total / 4);    // it may still grow before the next call
+    }
+}
+
+}  // namespace PluginAPI
@@ -0,0 +1,80 @@
+#include "StartupProbe.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+#include "ObjectArray.h"
+#include "SDK/SDK/Engine_classes.hpp"
+
+StartupProbe::Result StartupProbe::WaitFor(const std::function<bool()>& Ready, std::chrono::milliseconds Timeout,
+	std::chrono::milliseconds InitialInterval, std::chrono::milliseconds MaxInterval)
+{
+	Result PhaseResult;
+	auto Start = std::chrono::steady_clock::now();
+	auto Deadline = Start + Timeout;
+	auto Interval = InitialInterval;
+
+	while (true)
+	{
+		++PhaseResult.Polls;
+		bool bReady = false;
+		try
+		{
+			bReady = Ready();
+		}
+		catch (...)
+		{
+			// Treated as not ready yet; the game may still be constructing what the probe reads
+		}
+
+		auto Now = std::chrono::steady_clock::now();
+		PhaseResult.ElapsedMs = std::chrono::duration<double, std::milli>(Now - Start).count();
+		if (bReady)
+		{
+			PhaseResult.bReady = true;
+			return PhaseResult;
+		}
+		if (Now >= Deadline)
+			return PhaseResult;
+
+		std::chrono::steady_clock::duration Remaining = Deadline - Now;
+		std::this_thread::sleep_for((std::min)(std::chrono::steady_clock::duration(Interval), Remaining));
+		Interval = (std::min)(Interval * 2, MaxInterval);
+	}
+}
+
+bool StartupProbe::GObjectsPopulated(int32_t MinObjects)
+{
+	// The count is checked first: the chunk table is only read once the engine has added objects
+	return ObjectArray::Num() >= MinObjects && ObjectArray::GetItem(0) != nullptr;
+}
+
+bool StartupProbe::NamePoolReady()
+{
+	SDK::UObject* First = ObjectArray::GetItem(0) ? ObjectArray::GetItem(0)->Object : nullptr;
+	if (!First)
+		return false;
+
+	std::string Name = First->GetName();
+	return !Name.empty() && Name != "None";
+}
+
+bool StartupProbe::GameEnginePresent()
+{
+	// GetEngine() scans GObjects until it finds the engine, then returns the cached pointer
+	return SDK::UEngine::GetEngine() != nullptr;
+}
+
+std::string StartupProbe::Describe(const char* Phase, const Result& PhaseResult)
+{
+	std::stringstream ss;
+	ss << "[Startup] " << Phase << (PhaseResult.bReady ? " ready after " : " not ready after ")
+		<< std::fixed << std::setprecision(0) << PhaseResult.ElapsedMs << " ms";
+	if (PhaseResult.bReady)
+		ss << " (" << PhaseResult.Polls << " polls)";
+	else
+		ss << ", continuing anyway";
+	return ss.str();
+}
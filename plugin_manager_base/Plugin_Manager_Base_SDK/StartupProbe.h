@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+/**
+* Readiness probes for startup
+* Instead of sleeping a fixed time before each startup phase, MainThread polls the phase's
+* precondition: first every 10 ms, doubling up to 250 ms between polls, so a phase starts
+* right after its precondition holds on a fast machine and a slow one isn't hooked too early.
+* A probe that doesn't succeed within its timeout lets startup continue anyway (an outdated
+* SDK offset shouldn't leave the loader waiting forever), and the caller logs the outcome.
+*
+* Once every phase has run (or MainThread gave up on an exception), MarkComplete() publishes
+* that to other modules through the exported IsStartupComplete(); the GUI keeps its menu hotkey
+* locked until then, or for at most F1_LOCK_MAX_MS.
+*/
+
+class StartupProbe
+{
+public:
+	struct Result
+	{
+		bool bReady = false;
+		int Polls = 0;
+		double ElapsedMs = 0.0;
+	};
+
+	// Poll Ready with exponential backoff until it returns true or Timeout passes
+	static Result WaitFor(const std::function<bool()>& Ready, std::chrono::milliseconds Timeout,
+		std::chrono::milliseconds InitialInterval = std::chrono::milliseconds(10),
+		std::chrono::milliseconds MaxInterval = std::chrono::milliseconds(250));
+
+	// GObjects has at least MinObjects slots in use
+	static bool GObjectsPopulated(int32_t MinObjects);
+
+	// The first object's FName resolves, so the name pool is up
+	static bool NamePoolReady();
+
+	// The GameEngine object exists
+	static bool GameEnginePresent();
+
+	// "<Phase> ready after X ms (N polls)" / "<Phase> not ready after X ms, continuing"
+	static std::string Describe(const char* Phase, const Result& PhaseResult);
+
+	static void MarkComplete() { bComplete.store(true, std::memory_order_release); }
+	static bool IsComplete() { return bComplete.load(std::memory_order_acquire); }
+
+private:
+	static inline std::atomic<bool> bComplete{ false };
+};
@@ -0,0 +1,156 @@
+/**
+* GUILoggerBench - latency of GUILogger::Log on the render thread
+*
+* Calls the real GUILogger (gui-plugin-manager/GUILogger.cpp) from one "render" thread and
+* reports the latency of a single call (p50 / p99 / p99.9 / max) and the calls/s it sustains:
+*   staged           Log(): format + append to the staging buffer; the flusher commits batches
+*   commit per line  Log() + FlushNow(): every line committed to the file and the Debug Log ring
+*                    on the calling thread, as GUILogger did before the staging buffer
+*   error            Log("[ERROR] ..."): error lines are committed before Log returns
+* With --threads T, T more threads log continuously during each run (plugins logging from their
+* own threads), so the render thread also contends for the staging lock.
+*
+* Build (Linux):
+*   g++ -std=c++20 -O2 -pthread -o guiloggerbench tools/GUILoggerBench/GUILoggerBench.cpp \
+*       gui-plugin-manager/GUILogger.cpp
+*
+* Usage:
+*   guiloggerbench [--lines N] [--threads T] [--dir D]    defaults: 200000 lines, 0 threads, /tmp
+*
+* OutputDebugString is a no-op off Windows, so "commit per line" understates the old cost there.
+*/
+
+#include "../../gui-plugin-manager/GUILogger.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	struct Options
+	{
+		uint64_t Lines = 200000;
+		int Threads = 0;
+		std::string Directory = "/tmp";
+	};
+
+	// Typical GUI log messages, varied in length like real ones
+	const char* Messages[] = {
+		"[INFO] [PluginManager] Loaded %s in %d ms",
+		"[DEBUG] [WorldContext] Pawn cache refreshed for %s (%d objects)",
+		"[INFO] [ObjectBrowser] Query '%s' matched %d rows",
+		"[WARNING] [PluginManager] %s: cannot hook yet, still retrying (%d)",
+	};
+	const char* Arguments[] = { "FunctionLogger", "BP_PlayerPawn_C", "ui_script_menu_base_C", "World_P" };
+
+	uint32_t Percentile(const std::vector<uint32_t>& Sorted, double P)
+	{
+		if (Sorted.empty())
+			return 0;
+		size_t Index = static_cast<size_t>(P * static_cast<double>(Sorted.size() - 1) + 0.5);
+		return Sorted[(std::min)(Index, Sorted.size() - 1)];
+	}
+
+	// Times Call(i) Lines times on this thread while Threads background loggers run
+	void Run(const char* Name, const Options& Opts, const std::function<void(uint64_t)>& Call)
+	{
+		std::atomic<bool> bStop{ false };
+		std::vector<std::thread> Background;
+		for (int t = 0; t < Opts.Threads; ++t)
+		{
+			Background.emplace_back([&, t]() {
+				for (uint64_t i = 0; !bStop.load(std::memory_order_relaxed); ++i)
+					GUILogger::Get().LogToFileOnly("[DEBUG] [Plugin%d] background line %llu", t, static_cast<unsigned long long>(i));
+			});
+		}
+
+		std::vector<uint32_t> LatenciesNs(Opts.Lines);
+		auto Start = Clock::now();
+		for (uint64_t i = 0; i < Opts.Lines; ++i)
+		{
+			auto Before = Clock::now();
+			Call(i);
+			auto After = Clock::now();
+			LatenciesNs[i] = static_cast<uint32_t>((std::min<int64_t>)(
+				std::chrono::duration_cast<std::chrono::nanoseconds>(After - Before).count(), UINT32_MAX));
+		}
+		double Seconds = std::chrono::duration<double>(Clock::now() - Start).count();
+
+		bStop.store(true);
+		for (std::thread& Thread : Background)
+			Thread.join();
+		GUILogger::Get().FlushNow();
+
+		std::sort(LatenciesNs.begin(), LatenciesNs.end());
+		std::printf("%-16s %12.0f %8u %8u %9u %10u\n", Name, Opts.Lines / Seconds,
+			Percentile(LatenciesNs, 0.50), Percentile(LatenciesNs, 0.99),
+			Percentile(LatenciesNs, 0.999), LatenciesNs.back());
+	}
+
+	bool ParseArgs(int argc, char** argv, Options& Opts)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string_view Arg = argv[i];
+			if (i + 1 >= argc)
+				return false;
+			if (Arg == "--lines")
+				Opts.Lines = std::strtoull(argv[++i], nullptr, 10);
+			else if (Arg == "--threads")
+				Opts.Threads = std::atoi(argv[++i]);
+			else if (Arg == "--dir")
+				Opts.Directory = argv[++i];
+			else
+				return false;
+		}
+		return Opts.Lines > 0 && Opts.Threads >= 0;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Options Opts;
+	if (!ParseArgs(argc, argv, Opts))
+	{
+		std::fprintf(stderr, "usage: guiloggerbench [--lines N] [--threads T] [--dir D]\n");
+		return 2;
+	}
+
+	const std::string Path = (std::filesystem::path(Opts.Directory) / "guiloggerbench.log").string();
+	std::filesystem::remove(Path);
+	GUILogger& Logger = GUILogger::Get();
+	Logger.Initialize(Path);
+
+	std::printf("%llu lines on the render thread, %d background thread(s), %s\n\n",
+		static_cast<unsigned long long>(Opts.Lines), Opts.Threads, Path.c_str());
+	std::printf("%-16s %12s %8s %8s %9s %10s\n", "mode", "calls/s", "p50 ns", "p99 ns", "p99.9 ns", "max ns");
+
+	Run("staged", Opts, [&](uint64_t i) {
+		Logger.Log(Messages[i % 4], Arguments[i % 4], static_cast<int>(i % 1000));
+	});
+
+	Run("commit per line", Opts, [&](uint64_t i) {
+		Logger.Log(Messages[i % 4], Arguments[i % 4], static_cast<int>(i % 1000));
+		Logger.FlushNow();
+	});
+
+	Run("error", Opts, [&](uint64_t i) {
+		Logger.Log("[ERROR] [Bench] %s failed (%d)", Arguments[i % 4], static_cast<int>(i % 1000));
+	});
+
+	Logger.Shutdown();
+	std::filesystem::remove(Path);
+	return 0;
+}
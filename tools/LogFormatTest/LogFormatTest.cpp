@@ -0,0 +1,195 @@
+/**
+* LogFormatTest - checks that log records are formatted without heap allocations
+*
+* Replaces the global operator new/delete with counting versions and builds records through the
+* same LogFormat.h helpers FunctionLogger and GUILogger call (FormatFunctionCall, FormatGuiLine),
+* checks their layout, then checks truncation at capacity. After one warm-up record per timestamp style, the steady-state
+* loop runs across several second boundaries (so the cached timestamp prefix is rebuilt too) and
+* must not allocate at all.
+*
+* Build (Linux):
+*   g++ -std=c++20 -O2 -o logformattest tools/LogFormatTest/LogFormatTest.cpp
+*
+* Usage:
+*   logformattest [seconds]      run the steady-state loop for that long (default 3)
+*
+* Exits with 0 when every check passed, 1 otherwise.
+*/
+
+#include "../../plugin_manager_base/Plugin_Manager_Base_SDK/LogFormat.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <string_view>
+
+namespace
+{
+	std::atomic<uint64_t> g_Allocations{ 0 };
+	std::atomic<bool> g_Counting{ false };
+
+	void* CountedAlloc(size_t Size)
+	{
+		if (g_Counting.load(std::memory_order_relaxed))
+			g_Allocations.fetch_add(1, std::memory_order_relaxed);
+		void* Memory = std::malloc(Size ? Size : 1);
+		if (!Memory)
+			throw std::bad_alloc();
+		return Memory;
+	}
+
+	void* CountedAlignedAlloc(size_t Size, std::align_val_t Alignment)
+	{
+		if (g_Counting.load(std::memory_order_relaxed))
+			g_Allocations.fetch_add(1, std::memory_order_relaxed);
+		size_t Align = static_cast<size_t>(Alignment);
+		void* Memory = std::aligned_alloc(Align, (Size + Align - 1) / Align * Align);
+		if (!Memory)
+			throw std::bad_alloc();
+		return Memory;
+	}
+
+	int g_Failures = 0;
+
+	void Check(bool bCondition, const char* What)
+	{
+		if (!bCondition)
+		{
+			std::printf("FAIL: %s\n", What);
+			++g_Failures;
+		}
+	}
+
+	// FunctionLogger::WriteFunctionCall's record buffer
+	using LogRecord = LogFormat::FixedBuffer<4096>;
+
+	// GUILogger::Log's line buffer
+	using GuiLine = LogFormat::FixedBuffer<2100>;
+
+	size_t FormatFunctionCall(LogRecord& Record, std::string_view Object, std::string_view Name, uintptr_t Address, int64_t Duration)
+	{
+		LogFormat::FormatFunctionCall(Record, LogFormat::FunctionCallFields{}, Name, Object, Address, "", "", Duration);
+		return Record.Size();
+	}
+
+	size_t FormatGuiLine(GuiLine& Line, std::string_view Message)
+	{
+		LogFormat::FormatGuiLine(Line, Message);
+		return Line.Size();
+	}
+}
+
+void* operator new(size_t Size) { return CountedAlloc(Size); }
+void* operator new[](size_t Size) { return CountedAlloc(Size); }
+void* operator new(size_t Size, const std::nothrow_t&) noexcept
+{
+	try { return CountedAlloc(Size); } catch (...) { return nullptr; }
+}
+void* operator new[](size_t Size, const std::nothrow_t&) noexcept
+{
+	try { return CountedAlloc(Size); } catch (...) { return nullptr; }
+}
+void* operator new(size_t Size, std::align_val_t Alignment) { return CountedAlignedAlloc(Size, Alignment); }
+void* operator new[](size_t Size, std::align_val_t Alignment) { return CountedAlignedAlloc(Size, Alignment); }
+void operator delete(void* Memory) noexcept { std::free(Memory); }
+void operator delete[](void* Memory) noexcept { std::free(Memory); }
+void operator delete(void* Memory, size_t) noexcept { std::free(Memory); }
+void operator delete[](void* Memory, size_t) noexcept { std::free(Memory); }
+void operator delete(void* Memory, std::align_val_t) noexcept { std::free(Memory); }
+void operator delete[](void* Memory, std::align_val_t) noexcept { std::free(Memory); }
+void operator delete(void* Memory, size_t, std::align_val_t) noexcept { std::free(Memory); }
+void operator delete[](void* Memory, size_t, std::align_val_t) noexcept { std::free(Memory); }
+
+int main(int argc, char** argv)
+{
+	double Seconds = argc > 1 ? std::atof(argv[1]) : 3.0;
+	if (Seconds <= 0)
+		Seconds = 3.0;
+
+	// Built before counting starts: callers keep their names in long-lived strings too
+	const std::string Object = "/Game/Maps/World_P.World_P:PersistentLevel.ui_script_menu_base_C_2147482101";
+	const std::string Name = "MenuOpen";
+	const std::string GuiMessage = "Plugin loaded: TestPlugin v1.0.0";
+	const std::string Long(8192, 'x');
+
+	LogRecord Record;
+	GuiLine Line;
+	LogFormat::FixedBuffer<64> Small;
+
+	// Warm-up: the first record per thread and style builds the timestamp cache
+	FormatFunctionCall(Record, Object, Name, 0x7FF6A1B2C3D4, 42);
+	FormatGuiLine(Line, GuiMessage);
+
+	// Output checks
+	{
+		std::string_view Text = Record.View();
+		Check(Text.size() > LogFormat::MaxTimestampLength && Text.front() == '[', "record starts with a timestamp");
+		Check(Text.find("] FUNCTION CALL | Object: ") == LogFormat::MaxTimestampLength + 1, "DateTime timestamp has the full width");
+		Check(Text.find(" | Name: MenuOpen | Address: 0x7ff6a1b2c3d4 | Duration: 42us\n") != std::string_view::npos, "record fields");
+		Check(Text.back() == '\n' && Text.find('\n') == Text.size() - 1, "record ends in exactly one newline");
+
+		// FunctionLogger's [Output] switches drop their fields; empty params / return are left out
+		LogFormat::FunctionCallFields Minimal;
+		Minimal.bObjectPath = false;
+		Minimal.bAddress = false;
+		LogFormat::FormatFunctionCall(Record, Minimal, Name, Object, 0x1234, "Count=3", "", -1);
+		Text = Record.View();
+		Check(Text.substr(LogFormat::MaxTimestampLength + 3) == "FUNCTION CALL | Name: MenuOpen | Params: Count=3\n", "record without optional fields");
+
+		// GUILogger line: "[HH:MM:SS.mmm] message"
+		std::string_view Gui = Line.View();
+		Check(Gui.size() == 15 + GuiMessage.size() + 1 && Gui[0] == '[' && Gui[13] == ']' && Gui[14] == ' ', "GUI line has a time-only timestamp");
+		Check(Gui.substr(15) == GuiMessage + "\n", "GUI line carries the message unchanged");
+
+		Small.Append(Long);
+		Small.TerminateLine();
+		Check(Small.Size() == 63 && Small.View().back() == '\n' && Small.CStr()[63] == '\0', "truncated record keeps its newline and terminator");
+
+		Small.Clear();
+		Small.Format("{} {}", Long, 7);
+		Check(Small.Size() == 63, "Format truncates at capacity");
+	}
+
+	// Steady state: nothing below may touch the heap
+	uint64_t Records = 0;
+	uint64_t Bytes = 0;
+	auto Start = std::chrono::steady_clock::now();
+	auto End = Start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(Seconds));
+
+	g_Allocations.store(0);
+	g_Counting.store(true);
+	while (std::chrono::steady_clock::now() < End)
+	{
+		for (int i = 0; i < 1000; ++i)
+		{
+			Bytes += FormatFunctionCall(Record, Object, Name, 0x7FF6A1B2C3D4 + i, i);
+			Bytes += FormatGuiLine(Line, GuiMessage);
+
+			Small.Clear();
+			LogFormat::AppendTimestamp(Small, LogFormat::TimestampStyle::DateTime);
+			Small.Append(Long);
+			Small.TerminateLine();
+			Bytes += Small.Size();
+		}
+		Records += 3000;
+	}
+	g_Counting.store(false);
+
+	uint64_t Allocations = g_Allocations.load();
+	double Elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+	std::printf("%llu records (%llu bytes) in %.2f s, %.0f records/s, %llu heap allocations\n",
+		static_cast<unsigned long long>(Records), static_cast<unsigned long long>(Bytes), Elapsed,
+		Records / Elapsed, static_cast<unsigned long long>(Allocations));
+	Check(Allocations == 0, "steady-state formatting does not allocate");
+
+	if (g_Failures > 0)
+	{
+		std::printf("%d check(s) failed\n", g_Failures);
+		return 1;
+	}
+	std::printf("OK\n");
+	return 0;
+}
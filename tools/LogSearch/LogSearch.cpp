@@ -0,0 +1,712 @@
+/**
+* LogSearch - indexed offline search for function_log output
+*
+* Builds a sidecar index (<log>.idx) in one parallel pass over the log, then answers queries
+* from the index without re-scanning the log:
+*   - per-function postings: (file offset, timestamp) of every FUNCTION CALL record
+*   - time index: min/max timestamp and offset range of every block of IndexStride records
+*
+* Works on plain logs and on compressed rotation segments (.lz); a .lz segment is decompressed
+* in memory when indexing and when record text has to be printed.
+*
+* Build (Linux):
+*   g++ -std=c++20 -O2 -pthread -o logsearch tools/LogSearch/LogSearch.cpp \
+*       plugin_manager_base/Plugin_Manager_Base_SDK/LogCompression.cpp
+*
+* Usage:
+*   logsearch index     <log>                                   (re)build <log>.idx
+*   logsearch functions <log>                                   call totals per function
+*   logsearch calls     <log> <Function> [--from T] [--to T]    print matching records
+*   logsearch range     <log> [--from T] [--to T]               print every record in range
+*   logsearch count     <log> [--function F] [--from T] [--to T] calls per function per minute
+*
+* T is "YYYY-MM-DD HH:MM:SS[.mmm]" or "HH:MM[:SS]" (same day as the first record).
+*/
+
+#include "../../plugin_manager_base/Plugin_Manager_Base_SDK/LogCompression.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	constexpr char IndexMagic[4] = { 'B', 'L', 'I', 'X' };
+	constexpr uint32_t IndexVersion = 1;
+	constexpr uint32_t IndexStride = 4096;
+	constexpr int64_t NoTime = INT64_MIN;
+
+	struct Posting
+	{
+		uint64_t Offset;
+		int64_t TimeMs;
+	};
+
+	struct TimeBlock
+	{
+		uint64_t StartOffset;
+		uint64_t EndOffset;
+		int64_t MinTimeMs;
+		int64_t MaxTimeMs;
+	};
+
+	struct IndexHeader
+	{
+		char Magic[4];
+		uint32_t Version;
+		uint64_t SourceSize;
+		int64_t SourceMtime;
+		uint64_t RecordCount;
+		uint32_t FunctionCount;
+		uint32_t Stride;
+		uint64_t BlockCount;
+		int64_t FirstDayMs;
+	};
+
+	struct FunctionEntry
+	{
+		std::string Name;
+		std::vector<Posting> Postings;
+	};
+
+	struct LogIndex
+	{
+		IndexHeader Header{};
+		std::vector<FunctionEntry> Functions;
+		std::vector<TimeBlock> Blocks;
+	};
+
+	// ===== Source file access =====
+
+	struct SourceView
+	{
+		const char* Data = nullptr;
+		size_t Size = 0;
+		int64_t Mtime = 0;
+		size_t FileSize = 0;
+
+		void* Mapping = nullptr;
+		std::vector<uint8_t> Decompressed;
+
+		~SourceView()
+		{
+			if (Mapping)
+				munmap(Mapping, FileSize);
+		}
+	};
+
+	bool EndsWith(const std::string& Text, std::string_view Suffix)
+	{
+		return Text.size() >= Suffix.size() && Text.compare(Text.size() - Suffix.size(), Suffix.size(), Suffix) == 0;
+	}
+
+	bool StatFile(const std::string& Path, size_t& Size, int64_t& Mtime)
+	{
+		struct stat St;
+		if (stat(Path.c_str(), &St) != 0)
+			return false;
+		Size = static_cast<size_t>(St.st_size);
+		Mtime = static_cast<int64_t>(St.st_mtime);
+		return true;
+	}
+
+	bool OpenSource(const std::string& Path, SourceView& View)
+	{
+		if (!StatFile(Path, View.FileSize, View.Mtime))
+		{
+			fprintf(stderr, "logsearch: cannot stat %s\n", Path.c_str());
+			return false;
+		}
+		if (View.FileSize == 0)
+			return true;
+
+		int Fd = open(Path.c_str(), O_RDONLY);
+		if (Fd < 0)
+		{
+			fprintf(stderr, "logsearch: cannot open %s\n", Path.c_str());
+			return false;
+		}
+		View.Mapping = mmap(nullptr, View.FileSize, PROT_READ, MAP_PRIVATE, Fd, 0);
+		close(Fd);
+		if (View.Mapping == MAP_FAILED)
+		{
+			View.Mapping = nullptr;
+			fprintf(stderr, "logsearch: cannot map %s\n", Path.c_str());
+			return false;
+		}
+		madvise(View.Mapping, View.FileSize, MADV_SEQUENTIAL);
+
+		if (EndsWith(Path, LogCompression::FileExtension))
+		{
+			if (!LogCompression::DecompressBuffer(static_cast<const uint8_t*>(View.Mapping), View.FileSize, View.Decompressed))
+			{
+				fprintf(stderr, "logsearch: %s is not a valid compressed segment\n", Path.c_str());
+				return false;
+			}
+			View.Data = reinterpret_cast<const char*>(View.Decompressed.data());
+			View.Size = View.Decompressed.size();
+		}
+		else
+		{
+			View.Data = static_cast<const char*>(View.Mapping);
+			View.Size = View.FileSize;
+		}
+
+		// A log still open by the game (or left by a crash) is padded with NULs past its end
+		while (View.Size > 0 && View.Data[View.Size - 1] == '\0')
+			--View.Size;
+		return true;
+	}
+
+	// ===== Time handling (timestamps are local wall-clock time, kept as naive epoch ms) =====
+
+	int64_t DaysFromCivil(int64_t Y, unsigned M, unsigned D)
+	{
+		Y -= M <= 2;
+		const int64_t Era = (Y >= 0 ? Y : Y - 399) / 400;
+		const unsigned Yoe = static_cast<unsigned>(Y - Era * 400);
+		const unsigned Doy = (153 * (M + (M > 2 ? -3 : 9)) + 2) / 5 + D - 1;
+		const unsigned Doe = Yoe * 365 + Yoe / 4 - Yoe / 100 + Doy;
+		return Era * 146097 + static_cast<int64_t>(Doe) - 719468;
+	}
+
+	bool ParseDigits(const char* P, size_t Count, int& Out)
+	{
+		Out = 0;
+		for (size_t i = 0; i < Count; ++i)
+		{
+			if (P[i] < '0' || P[i] > '9')
+				return false;
+			Out = Out * 10 + (P[i] - '0');
+		}
+		return true;
+	}
+
+	// "YYYY-MM-DD HH:MM:SS" with optional ".mmm"; returns the number of characters consumed
+	size_t ParseDateTime(const char* P, size_t Length, int64_t& TimeMs)
+	{
+		int Year, Month, Day, Hour, Minute, Second, Milli = 0;
+		if (Length < 19 || P[4] != '-' || P[7] != '-' || (P[10] != ' ' && P[10] != 'T') || P[13] != ':' || P[16] != ':')
+			return 0;
+		if (!ParseDigits(P, 4, Year) || !ParseDigits(P + 5, 2, Month) || !ParseDigits(P + 8, 2, Day) ||
+			!ParseDigits(P + 11, 2, Hour) || !ParseDigits(P + 14, 2, Minute) || !ParseDigits(P + 17, 2, Second))
+			return 0;
+
+		size_t Used = 19;
+		if (Length >= 23 && P[19] == '.' && ParseDigits(P + 20, 3, Milli))
+			Used = 23;
+
+		TimeMs = ((DaysFromCivil(Year, Month, Day) * 24 + Hour) * 60 + Minute) * 60000LL + Second * 1000LL + Milli;
+		return Used;
+	}
+
+	void FormatMinute(int64_t TimeMs, char* Out, size_t OutSize)
+	{
+		int64_t Minutes = TimeMs / 60000;
+		int64_t Days = Minutes / 1440;
+		int MinuteOfDay = static_cast<int>(Minutes % 1440);
+
+		// civil_from_days
+		int64_t Z = Days + 719468;
+		const int64_t Era = (Z >= 0 ? Z : Z - 146096) / 146097;
+		const unsigned Doe = static_cast<unsigned>(Z - Era * 146097);
+		const unsigned Yoe = (Doe - Doe / 1460 + Doe / 36524 - Doe / 146096) / 365;
+		const unsigned Doy = Doe - (365 * Yoe + Yoe / 4 - Yoe / 100);
+		const unsigned Mp = (5 * Doy + 2) / 153;
+		const unsigned D = Doy - (153 * Mp + 2) / 5 + 1;
+		const unsigned M = Mp < 10 ? Mp + 3 : Mp - 9;
+		const int64_t Y = static_cast<int64_t>(Yoe) + Era * 400 + (M <= 2);
+
+		snprintf(Out, OutSize, "%04lld-%02u-%02u %02d:%02d", static_cast<long long>(Y), M, D, MinuteOfDay / 60, MinuteOfDay % 60);
+	}
+
+	// Command line time: full date/time, or "HH:MM[:SS]" on the day of the first record
+	bool ParseQueryTime(const std::string& Text, int64_t FirstDayMs, int64_t& TimeMs)
+	{
+		if (ParseDateTime(Text.c_str(), Text.size(), TimeMs))
+			return true;
+
+		int Hour, Minute, Second = 0;
+		if (Text.size() >= 5 && Text[2] == ':' && ParseDigits(Text.c_str(), 2, Hour) && ParseDigits(Text.c_str() + 3, 2, Minute))
+		{
+			if (Text.size() >= 8 && Text[5] == ':' && !ParseDigits(Text.c_str() + 6, 2, Second))
+				return false;
+			TimeMs = FirstDayMs + (Hour * 3600LL + Minute * 60LL + Second) * 1000LL;
+			return true;
+		}
+		return false;
+	}
+
+	// ===== Record parsing =====
+
+	struct ParsedRecord
+	{
+		int64_t TimeMs = NoTime;
+		std::string_view Function;
+	};
+
+	// Lines look like "[2025-01-31 13:37:00.123] FUNCTION CALL | Object: ... | Name: Foo | ..."
+	bool ParseRecord(std::string_view Line, ParsedRecord& Record)
+	{
+		if (Line.size() < 2 || Line[0] != '[')
+			return false;
+
+		size_t Used = ParseDateTime(Line.data() + 1, Line.size() - 1, Record.TimeMs);
+		if (!Used || Line.size() < Used + 3 || Line[Used + 1] != ']')
+			return false;
+
+		std::string_view Body = Line.substr(Used + 3);
+		if (Body.substr(0, 13) != "FUNCTION CALL")
+			return false;
+
+		size_t NamePos = Body.find(" | Name: ");
+		if (NamePos == std::string_view::npos)
+			return false;
+
+		std::string_view Name = Body.substr(NamePos + 9);
+		size_t NameEnd = Name.find(" | ");
+		Record.Function = NameEnd == std::string_view::npos ? Name : Name.substr(0, NameEnd);
+		while (!Record.Function.empty() && (Record.Function.back() == '\r' || Record.Function.back() == ' '))
+			Record.Function.remove_suffix(1);
+		return !Record.Function.empty();
+	}
+
+	// ===== Index build =====
+
+	struct ChunkResult
+	{
+		std::unordered_map<std::string_view, uint32_t> LocalIds;
+		std::vector<std::string_view> LocalNames;
+		std::vector<std::vector<Posting>> Postings;
+		std::vector<TimeBlock> Blocks;
+		uint64_t RecordCount = 0;
+		int64_t FirstTimeMs = NoTime;
+	};
+
+	void IndexChunk(const char* Data, size_t Begin, size_t End, ChunkResult& Result)
+	{
+		TimeBlock Block{ Begin, Begin, INT64_MAX, INT64_MIN };
+		uint32_t InBlock = 0;
+
+		size_t Pos = Begin;
+		while (Pos < End)
+		{
+			const char* LineEnd = static_cast<const char*>(memchr(Data + Pos, '\n', End - Pos));
+			size_t Next = LineEnd ? static_cast<size_t>(LineEnd - Data) + 1 : End;
+			std::string_view Line(Data + Pos, Next - Pos - (LineEnd ? 1 : 0));
+
+			ParsedRecord Record;
+			if (ParseRecord(Line, Record))
+			{
+				auto [It, bInserted] = Result.LocalIds.try_emplace(Record.Function, static_cast<uint32_t>(Result.LocalNames.size()));
+				if (bInserted)
+				{
+					Result.LocalNames.push_back(Record.Function);
+					Result.Postings.emplace_back();
+				}
+				Result.Postings[It->second].push_back({ Pos, Record.TimeMs });
+
+				if (Result.FirstTimeMs == NoTime)
+					Result.FirstTimeMs = Record.TimeMs;
+
+				if (InBlock == 0)
+					Block = { Pos, Pos, INT64_MAX, INT64_MIN };
+				Block.MinTimeMs = std::min(Block.MinTimeMs, Record.TimeMs);
+				Block.MaxTimeMs = std::max(Block.MaxTimeMs, Record.TimeMs);
+				Block.EndOffset = Next;
+				if (++InBlock == IndexStride)
+				{
+					Result.Blocks.push_back(Block);
+					InBlock = 0;
+				}
+				++Result.RecordCount;
+			}
+
+			Pos = Next;
+		}
+
+		if (InBlock > 0)
+			Result.Blocks.push_back(Block);
+	}
+
+	LogIndex BuildIndex(const SourceView& View)
+	{
+		unsigned ThreadCount = std::max(1u, std::thread::hardware_concurrency());
+		size_t MinChunk = 4 << 20;
+		ThreadCount = static_cast<unsigned>(std::min<size_t>(ThreadCount, View.Size / MinChunk + 1));
+
+		// Chunk boundaries snapped forward to the next line start
+		std::vector<size_t> Bounds(ThreadCount + 1, View.Size);
+		Bounds[0] = 0;
+		for (unsigned i = 1; i < ThreadCount; ++i)
+		{
+			size_t Guess = View.Size / ThreadCount * i;
+			const char* Newline = static_cast<const char*>(memchr(View.Data + Guess, '\n', View.Size - Guess));
+			Bounds[i] = Newline ? static_cast<size_t>(Newline - View.Data) + 1 : View.Size;
+			Bounds[i] = std::max(Bounds[i], Bounds[i - 1]);
+		}
+
+		std::vector<ChunkResult> Chunks(ThreadCount);
+		{
+			std::vector<std::thread> Workers;
+			for (unsigned i = 0; i < ThreadCount; ++i)
+				Workers.emplace_back(IndexChunk, View.Data, Bounds[i], Bounds[i + 1], std::ref(Chunks[i]));
+			for (auto& Worker : Workers)
+				Worker.join();
+		}
+
+		// Merge in chunk order so postings stay in file order
+		LogIndex Index;
+		std::unordered_map<std::string_view, uint32_t> GlobalIds;
+		int64_t FirstTimeMs = NoTime;
+		for (auto& Chunk : Chunks)
+		{
+			for (size_t Local = 0; Local < Chunk.LocalNames.size(); ++Local)
+			{
+				auto [It, bInserted] = GlobalIds.try_emplace(Chunk.LocalNames[Local], static_cast<uint32_t>(Index.Functions.size()));
+				if (bInserted)
+					Index.Functions.push_back({ std::string(Chunk.LocalNames[Local]), {} });
+				auto& Target = Index.Functions[It->second].Postings;
+				Target.insert(Target.end(), Chunk.Postings[Local].begin(), Chunk.Postings[Local].end());
+			}
+			Index.Blocks.insert(Index.Blocks.end(), Chunk.Blocks.begin(), Chunk.Blocks.end());
+			Index.Header.RecordCount += Chunk.RecordCount;
+			if (FirstTimeMs == NoTime)
+				FirstTimeMs = Chunk.FirstTimeMs;
+		}
+
+		// Writers take the timestamp before the log lock, so file order is only nearly sorted by time
+		{
+			std::vector<std::thread> Workers;
+			for (unsigned t = 0; t < ThreadCount; ++t)
+			{
+				Workers.emplace_back([&Index, t, ThreadCount]()
+				{
+					for (size_t i = t; i < Index.Functions.size(); i += ThreadCount)
+					{
+						auto& Postings = Index.Functions[i].Postings;
+						std::stable_sort(Postings.begin(), Postings.end(),
+							[](const Posting& A, const Posting& B) { return A.TimeMs < B.TimeMs; });
+					}
+				});
+			}
+			for (auto& Worker : Workers)
+				Worker.join();
+		}
+
+		std::sort(Index.Functions.begin(), Index.Functions.end(),
+			[](const FunctionEntry& A, const FunctionEntry& B) { return A.Name < B.Name; });
+
+		std::memcpy(Index.Header.Magic, IndexMagic, sizeof(IndexMagic));
+		Index.Header.Version = IndexVersion;
+		Index.Header.SourceSize = View.FileSize;
+		Index.Header.SourceMtime = View.Mtime;
+		Index.Header.FunctionCount = static_cast<uint32_t>(Index.Functions.size());
+		Index.Header.Stride = IndexStride;
+		Index.Header.BlockCount = Index.Blocks.size();
+		Index.Header.FirstDayMs = FirstTimeMs == NoTime ? 0 : FirstTimeMs - FirstTimeMs % 86400000;
+		return Index;
+	}
+
+	// ===== Index file =====
+	// Header, then per function: u32 name length, name, u64 posting count, postings; then blocks
+
+	bool WriteIndex(const std::string& Path, const LogIndex& Index)
+	{
+		std::string TempPath = Path + ".tmp";
+		FILE* File = fopen(TempPath.c_str(), "wb");
+		if (!File)
+			return false;
+
+		fwrite(&Index.Header, sizeof(Index.Header), 1, File);
+		for (const auto& Function : Index.Functions)
+		{
+			uint32_t NameLength = static_cast<uint32_t>(Function.Name.size());
+			uint64_t Count = Function.Postings.size();
+			fwrite(&NameLength, sizeof(NameLength), 1, File);
+			fwrite(Function.Name.data(), 1, NameLength, File);
+			fwrite(&Count, sizeof(Count), 1, File);
+			fwrite(Function.Postings.data(), sizeof(Posting), Count, File);
+		}
+		fwrite(Index.Blocks.data(), sizeof(TimeBlock), Index.Blocks.size(), File);
+
+		bool bOk = ferror(File) == 0;
+		bOk = (fclose(File) == 0) && bOk;
+		if (!bOk || rename(TempPath.c_str(), Path.c_str()) != 0)
+		{
+			unlink(TempPath.c_str());
+			return false;
+		}
+		return true;
+	}
+
+	bool ReadIndex(const std::string& Path, LogIndex& Index)
+	{
+		FILE* File = fopen(Path.c_str(), "rb");
+		if (!File)
+			return false;
+
+		bool bOk = fread(&Index.Header, sizeof(Index.Header), 1, File) == 1 &&
+			std::memcmp(Index.Header.Magic, IndexMagic, sizeof(IndexMagic)) == 0 &&
+			Index.Header.Version == IndexVersion;
+
+		for (uint32_t i = 0; bOk && i < Index.Header.FunctionCount; ++i)
+		{
+			FunctionEntry Function;
+			uint32_t NameLength = 0;
+			uint64_t Count = 0;
+			bOk = fread(&NameLength, sizeof(NameLength), 1, File) == 1 && NameLength < (1u << 20);
+			if (!bOk)
+				break;
+			Function.Name.resize(NameLength);
+			bOk = fread(Function.Name.data(), 1, NameLength, File) == NameLength &&
+				fread(&Count, sizeof(Count), 1, File) == 1;
+			if (!bOk)
+				break;
+			Function.Postings.resize(Count);
+			bOk = fread(Function.Postings.data(), sizeof(Posting), Count, File) == Count;
+			Index.Functions.push_back(std::move(Function));
+		}
+
+		if (bOk)
+		{
+			Index.Blocks.resize(Index.Header.BlockCount);
+			bOk = fread(Index.Blocks.data(), sizeof(TimeBlock), Index.Blocks.size(), File) == Index.Blocks.size();
+		}
+
+		fclose(File);
+		return bOk;
+	}
+
+	// Load <log>.idx, rebuilding it when missing or older than the log
+	bool LoadOrBuildIndex(const std::string& LogPath, LogIndex& Index, bool bForceRebuild)
+	{
+		std::string IndexPath = LogPath + ".idx";
+		size_t Size = 0;
+		int64_t Mtime = 0;
+		if (!StatFile(LogPath, Size, Mtime))
+		{
+			fprintf(stderr, "logsearch: cannot stat %s\n", LogPath.c_str());
+			return false;
+		}
+
+		if (!bForceRebuild && ReadIndex(IndexPath, Index) && Index.Header.SourceSize == Size && Index.Header.SourceMtime == Mtime)
+			return true;
+
+		Index = LogIndex{};
+		auto Start = std::chrono::steady_clock::now();
+
+		SourceView View;
+		if (!OpenSource(LogPath, View))
+			return false;
+		Index = BuildIndex(View);
+
+		if (!WriteIndex(IndexPath, Index))
+			fprintf(stderr, "logsearch: warning: cannot write %s, index kept in memory only\n", IndexPath.c_str());
+
+		double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+		fprintf(stderr, "logsearch: indexed %llu records, %u functions in %.2f s\n",
+			static_cast<unsigned long long>(Index.Header.RecordCount), Index.Header.FunctionCount, Seconds);
+		return true;
+	}
+
+	const FunctionEntry* FindFunction(const LogIndex& Index, std::string_view Name)
+	{
+		auto It = std::lower_bound(Index.Functions.begin(), Index.Functions.end(), Name,
+			[](const FunctionEntry& Entry, std::string_view Key) { return Entry.Name < Key; });
+		return (It != Index.Functions.end() && It->Name == Name) ? &*It : nullptr;
+	}
+
+	// Postings of one function within [From, To]
+	std::pair<const Posting*, const Posting*> PostingRange(const FunctionEntry& Function, int64_t From, int64_t To)
+	{
+		const Posting* Begin = Function.Postings.data();
+		const Posting* End = Begin + Function.Postings.size();
+		const Posting* Lo = std::lower_bound(Begin, End, From, [](const Posting& P, int64_t T) { return P.TimeMs < T; });
+		const Posting* Hi = std::upper_bound(Lo, End, To, [](int64_t T, const Posting& P) { return T < P.TimeMs; });
+		return { Lo, Hi };
+	}
+
+	void PrintLineAt(const SourceView& View, uint64_t Offset)
+	{
+		if (Offset >= View.Size)
+			return;
+		const char* Start = View.Data + Offset;
+		const char* End = static_cast<const char*>(memchr(Start, '\n', View.Size - Offset));
+		size_t Length = End ? static_cast<size_t>(End - Start) : View.Size - Offset;
+		fwrite(Start, 1, Length, stdout);
+		fputc('\n', stdout);
+	}
+
+	// ===== Commands =====
+
+	int CommandFunctions(const LogIndex& Index)
+	{
+		std::vector<const FunctionEntry*> Sorted;
+		for (const auto& Function : Index.Functions)
+			Sorted.push_back(&Function);
+		std::sort(Sorted.begin(), Sorted.end(),
+			[](const FunctionEntry* A, const FunctionEntry* B) { return A->Postings.size() > B->Postings.size(); });
+
+		for (const FunctionEntry* Function : Sorted)
+			printf("%12llu  %s\n", static_cast<unsigned long long>(Function->Postings.size()), Function->Name.c_str());
+		return 0;
+	}
+
+	int CommandCalls(const std::string& LogPath, const LogIndex& Index, const std::string& Name, int64_t From, int64_t To)
+	{
+		const FunctionEntry* Function = FindFunction(Index, Name);
+		if (!Function)
+		{
+			fprintf(stderr, "logsearch: no calls to %s\n", Name.c_str());
+			return 1;
+		}
+
+		auto [Lo, Hi] = PostingRange(*Function, From, To);
+		if (Lo == Hi)
+			return 0;
+
+		SourceView View;
+		if (!OpenSource(LogPath, View))
+			return 1;
+		for (const Posting* P = Lo; P != Hi; ++P)
+			PrintLineAt(View, P->Offset);
+		return 0;
+	}
+
+	int CommandRange(const std::string& LogPath, const LogIndex& Index, int64_t From, int64_t To)
+	{
+		SourceView View;
+		if (!OpenSource(LogPath, View))
+			return 1;
+
+		// Only blocks whose time span overlaps the range are scanned
+		for (const TimeBlock& Block : Index.Blocks)
+		{
+			if (Block.MaxTimeMs < From || Block.MinTimeMs > To)
+				continue;
+
+			size_t Pos = Block.StartOffset;
+			while (Pos < Block.EndOffset && Pos < View.Size)
+			{
+				const char* LineEnd = static_cast<const char*>(memchr(View.Data + Pos, '\n', View.Size - Pos));
+				size_t Next = LineEnd ? static_cast<size_t>(LineEnd - View.Data) + 1 : View.Size;
+				ParsedRecord Record;
+				if (ParseRecord(std::string_view(View.Data + Pos, Next - Pos - (LineEnd ? 1 : 0)), Record) &&
+					Record.TimeMs >= From && Record.TimeMs <= To)
+				{
+					PrintLineAt(View, Pos);
+				}
+				Pos = Next;
+			}
+		}
+		return 0;
+	}
+
+	int CommandCount(const LogIndex& Index, const std::string& Name, int64_t From, int64_t To)
+	{
+		// (minute, function) -> calls, answered from the postings alone
+		std::map<std::pair<int64_t, std::string_view>, uint64_t> Counts;
+		for (const auto& Function : Index.Functions)
+		{
+			if (!Name.empty() && Function.Name != Name)
+				continue;
+
+			auto [Lo, Hi] = PostingRange(Function, From, To);
+			for (const Posting* P = Lo; P != Hi; ++P)
+				++Counts[{ P->TimeMs / 60000, Function.Name }];
+		}
+
+		char Minute[32];
+		for (const auto& [Key, Count] : Counts)
+		{
+			FormatMinute(Key.first * 60000, Minute, sizeof(Minute));
+			printf("%s  %10llu  %.*s\n", Minute, static_cast<unsigned long long>(Count),
+				static_cast<int>(Key.second.size()), Key.second.data());
+		}
+		return 0;
+	}
+
+	void PrintUsage()
+	{
+		fprintf(stderr,
+			"usage:\n"
+			"  logsearch index     <log>\n"
+			"  logsearch functions <log>\n"
+			"  logsearch calls     <log> <Function> [--from T] [--to T]\n"
+			"  logsearch range     <log> [--from T] [--to T]\n"
+			"  logsearch count     <log> [--function F] [--from T] [--to T]\n"
+			"T: \"YYYY-MM-DD HH:MM:SS[.mmm]\" or \"HH:MM[:SS]\" (day of the first record)\n");
+	}
+}
+
+int main(int Argc, char** Argv)
+{
+	if (Argc < 3)
+	{
+		PrintUsage();
+		return 2;
+	}
+
+	std::string Command = Argv[1];
+	std::string LogPath = Argv[2];
+
+	std::vector<std::string> Positional;
+	std::string FromText, ToText, FunctionName;
+	for (int i = 3; i < Argc; ++i)
+	{
+		std::string Arg = Argv[i];
+		if (Arg == "--from" && i + 1 < Argc)
+			FromText = Argv[++i];
+		else if (Arg == "--to" && i + 1 < Argc)
+			ToText = Argv[++i];
+		else if (Arg == "--function" && i + 1 < Argc)
+			FunctionName = Argv[++i];
+		else
+			Positional.push_back(Arg);
+	}
+
+	LogIndex Index;
+	if (!LoadOrBuildIndex(LogPath, Index, Command == "index"))
+		return 1;
+
+	int64_t From = INT64_MIN;
+	int64_t To = INT64_MAX;
+	if (!FromText.empty() && !ParseQueryTime(FromText, Index.Header.FirstDayMs, From))
+	{
+		fprintf(stderr, "logsearch: bad time '%s'\n", FromText.c_str());
+		return 2;
+	}
+	if (!ToText.empty() && !ParseQueryTime(ToText, Index.Header.FirstDayMs, To))
+	{
+		fprintf(stderr, "logsearch: bad time '%s'\n", ToText.c_str());
+		return 2;
+	}
+
+	if (Command == "index")
+		return 0;
+	if (Command == "functions")
+		return CommandFunctions(Index);
+	if (Command == "calls" && !Positional.empty())
+		return CommandCalls(LogPath, Index, Positional[0], From, To);
+	if (Command == "range")
+		return CommandRange(LogPath, Index, From, To);
+	if (Command == "count")
+		return CommandCount(Index, FunctionName, From, To);
+
+	PrintUsage();
+	return 2;
+}
@@ -0,0 +1,245 @@
+/**
+* LogSinkBench - MappedLogSink against the std::ofstream log paths it replaced
+*
+* Writes the same pre-formatted log lines through each sink and reports throughput (lines/s,
+* measured from the first write until the file is closed) and the latency of a single write
+* call (p50 / p99 / p99.9 / max):
+*   ofstream+flush   std::ofstream, flush() after every line (GUILogger before MappedLogSink)
+*   ofstream         std::ofstream, buffered (FunctionLogger before MappedLogSink)
+*   mapped           MappedLogSink::Append
+*   mapped+sync      MappedLogSink::Append, Sync() every 1000 lines per thread
+* With more than one thread the ofstream sinks are guarded by a mutex, as in the loggers;
+* MappedLogSink is appended to concurrently.
+*
+* Build (Linux):
+*   g++ -std=c++20 -O2 -pthread -o logsinkbench tools/LogSinkBench/LogSinkBench.cpp
+*
+* Usage:
+*   logsinkbench [--lines N] [--threads T] [--dir D]    defaults: 1000000 lines, 1 thread, /tmp
+*
+* Each thread writes N / T lines. Timing every call adds the cost of one clock read per line to
+* every sink alike.
+*/
+
+#include "../../plugin_manager_base/Plugin_Manager_Base_SDK/MappedLogSink.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	struct Options
+	{
+		uint64_t Lines = 1000000;
+		int Threads = 1;
+		std::string Directory = "/tmp";
+	};
+
+	struct Result
+	{
+		const char* Name = "";
+		double Seconds = 0;
+		uint64_t Lines = 0;
+		std::vector<uint32_t> LatenciesNs;
+	};
+
+	// FunctionLogger-shaped records, varied in length like real ones
+	std::vector<std::string> MakeLines(size_t Count)
+	{
+		static const char* Objects[] = {
+			"/Game/Maps/World_P.World_P:PersistentLevel.ui_script_menu_base_C_2147482101",
+			"/Game/Pawns/Player/BP_PlayerPawn.Default__BP_PlayerPawn_C",
+			"/Script/Engine.Default__GameplayStatics",
+		};
+		static const char* Functions[] = { "MenuOpen", "ReceiveTick", "OnRep_Health", "K2_GetActorLocation" };
+
+		std::vector<std::string> Lines;
+		Lines.reserve(Count);
+		char Buffer[512];
+		for (size_t i = 0; i < Count; ++i)
+		{
+			int Length = std::snprintf(Buffer, sizeof(Buffer),
+				"[2025-01-31 13:37:%02zu.%03zu] FUNCTION CALL | Object: %s | Name: %s | Address: 0x%llx | Duration: %zuus\n",
+				(i / 1000) % 60, i % 1000, Objects[i % 3], Functions[i % 4],
+				0x7FF6A1B20000ull + (i % 4) * 0x40, i % 97);
+			Lines.emplace_back(Buffer, static_cast<size_t>(Length));
+		}
+		return Lines;
+	}
+
+	uint32_t Percentile(const std::vector<uint32_t>& Sorted, double P)
+	{
+		if (Sorted.empty())
+			return 0;
+		size_t Index = static_cast<size_t>(P * static_cast<double>(Sorted.size() - 1) + 0.5);
+		return Sorted[(std::min)(Index, Sorted.size() - 1)];
+	}
+
+	// Runs Write(Line) for every line on Options.Threads threads, then Close()
+	Result Run(const char* Name, const Options& Opts, const std::vector<std::string>& Lines,
+		const std::function<void(std::string_view)>& Write, const std::function<void()>& Close)
+	{
+		Result Out;
+		Out.Name = Name;
+
+		uint64_t PerThread = Opts.Lines / static_cast<uint64_t>(Opts.Threads);
+		std::vector<std::vector<uint32_t>> Latencies(static_cast<size_t>(Opts.Threads));
+		for (auto& Samples : Latencies)
+			Samples.resize(PerThread);
+
+		auto Start = Clock::now();
+		std::vector<std::thread> Workers;
+		for (int t = 0; t < Opts.Threads; ++t)
+		{
+			Workers.emplace_back([&, t]() {
+				std::vector<uint32_t>& Samples = Latencies[static_cast<size_t>(t)];
+				for (uint64_t i = 0; i < PerThread; ++i)
+				{
+					const std::string& Line = Lines[(i * static_cast<uint64_t>(Opts.Threads) + t) % Lines.size()];
+					auto Before = Clock::now();
+					Write(Line);
+					auto After = Clock::now();
+					Samples[i] = static_cast<uint32_t>((std::min<int64_t>)(
+						std::chrono::duration_cast<std::chrono::nanoseconds>(After - Before).count(), UINT32_MAX));
+				}
+			});
+		}
+		for (std::thread& Worker : Workers)
+			Worker.join();
+		Close();
+		Out.Seconds = std::chrono::duration<double>(Clock::now() - Start).count();
+		Out.Lines = PerThread * static_cast<uint64_t>(Opts.Threads);
+
+		for (auto& Samples : Latencies)
+			Out.LatenciesNs.insert(Out.LatenciesNs.end(), Samples.begin(), Samples.end());
+		std::sort(Out.LatenciesNs.begin(), Out.LatenciesNs.end());
+		return Out;
+	}
+
+	void Print(const Result& R, uint64_t FileBytes)
+	{
+		std::printf("%-16s %12.0f %10.1f %8u %8u %9u %10u\n", R.Name,
+			R.Lines / R.Seconds, FileBytes / R.Seconds / (1024.0 * 1024.0),
+			Percentile(R.LatenciesNs, 0.50), Percentile(R.LatenciesNs, 0.99),
+			Percentile(R.LatenciesNs, 0.999), R.LatenciesNs.empty() ? 0u : R.LatenciesNs.back());
+	}
+
+	uint64_t FileSize(const std::string& Path)
+	{
+		std::error_code Error;
+		uint64_t Size = std::filesystem::file_size(Path, Error);
+		return Error ? 0 : Size;
+	}
+
+	bool ParseArgs(int argc, char** argv, Options& Opts)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string_view Arg = argv[i];
+			if (i + 1 >= argc)
+				return false;
+			if (Arg == "--lines")
+				Opts.Lines = std::strtoull(argv[++i], nullptr, 10);
+			else if (Arg == "--threads")
+				Opts.Threads = std::atoi(argv[++i]);
+			else if (Arg == "--dir")
+				Opts.Directory = argv[++i];
+			else
+				return false;
+		}
+		return Opts.Lines > 0 && Opts.Threads > 0;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Options Opts;
+	if (!ParseArgs(argc, argv, Opts))
+	{
+		std::fprintf(stderr, "usage: logsinkbench [--lines N] [--threads T] [--dir D]\n");
+		return 2;
+	}
+
+	const std::vector<std::string> Lines = MakeLines(4096);
+	const std::string Path = (std::filesystem::path(Opts.Directory) / "logsinkbench.log").string();
+
+	std::printf("%llu lines, %d thread(s), %s\n\n", static_cast<unsigned long long>(Opts.Lines), Opts.Threads, Path.c_str());
+	std::printf("%-16s %12s %10s %8s %8s %9s %10s\n", "sink", "lines/s", "MB/s", "p50 ns", "p99 ns", "p99.9 ns", "max ns");
+
+	// ofstream + flush per line
+	{
+		std::ofstream File(Path, std::ios::out | std::ios::trunc | std::ios::binary);
+		std::mutex Mutex;
+		Result R = Run("ofstream+flush", Opts, Lines,
+			[&](std::string_view Line) {
+				std::lock_guard<std::mutex> Lock(Mutex);
+				File.write(Line.data(), static_cast<std::streamsize>(Line.size()));
+				File.flush();
+			},
+			[&]() { File.close(); });
+		Print(R, FileSize(Path));
+	}
+
+	// Buffered ofstream
+	{
+		std::ofstream File(Path, std::ios::out | std::ios::trunc | std::ios::binary);
+		std::mutex Mutex;
+		Result R = Run("ofstream", Opts, Lines,
+			[&](std::string_view Line) {
+				std::lock_guard<std::mutex> Lock(Mutex);
+				File.write(Line.data(), static_cast<std::streamsize>(Line.size()));
+			},
+			[&]() { File.close(); });
+		Print(R, FileSize(Path));
+	}
+
+	// MappedLogSink
+	{
+		MappedLogSink Sink;
+		if (!Sink.Open(Path))
+		{
+			std::fprintf(stderr, "cannot open %s\n", Path.c_str());
+			return 1;
+		}
+		Result R = Run("mapped", Opts, Lines,
+			[&](std::string_view Line) { Sink.Append(Line); },
+			[&]() { Sink.Close(); });
+		Print(R, FileSize(Path));
+	}
+
+	// MappedLogSink with a durability point every 1000 lines per thread
+	{
+		MappedLogSink Sink;
+		if (!Sink.Open(Path))
+		{
+			std::fprintf(stderr, "cannot open %s\n", Path.c_str());
+			return 1;
+		}
+		Result R = Run("mapped+sync", Opts, Lines,
+			[&](std::string_view Line) {
+				thread_local uint32_t Written = 0;
+				Sink.Append(Line);
+				if (++Written % 1000 == 0)
+					Sink.Sync();
+			},
+			[&]() { Sink.Close(); });
+		Print(R, FileSize(Path));
+	}
+
+	std::filesystem::remove(Path);
+	return 0;
+}
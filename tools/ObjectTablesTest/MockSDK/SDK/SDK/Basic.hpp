@@ -0,0 +1,109 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+* Mock of the generated SDK, for tools/ObjectTablesTest
+* Only what ObjectArray.h, ClassInstanceIndex, ObjectNameTable and ObjectPathCache touch: the
+* chunked GObjects array, FName as (ComparisonIndex, Number) into a name pool, and the UObject
+* fields Class / Name / Outer / Index / Flags. The test fills GObjects and NamePool itself.
+*/
+
+namespace SDK
+{
+	class UObject;
+	class UClass;
+
+	struct FUObjectItem
+	{
+		UObject* Object;
+		int32_t Flags;
+		int32_t ClusterRootIndex;
+		int32_t SerialNumber;
+		uint8_t Pad_14[0x4];
+	};
+
+	struct TUObjectArray
+	{
+		enum { ElementsPerChunk = 0x10000 };
+
+		FUObjectItem** Objects;
+		uint8_t Pad_8[0x8];
+		int32_t MaxElements;
+		int32_t NumElements;
+		int32_t MaxChunks;
+		int32_t NumChunks;
+
+		FUObjectItem** GetDecrytedObjPtr() const { return Objects; }
+		int32_t Num() const { return NumElements; }
+	};
+
+	// The generated SDK reaches GObjects through a wrapper with operator->
+	struct TUObjectArrayWrapper
+	{
+		TUObjectArray Array;
+
+		TUObjectArray* operator->() { return &Array; }
+		const TUObjectArray* operator->() const { return &Array; }
+	};
+
+	// Index -> base name; FName::Number N > 0 appends "_<N - 1>" as the engine does
+	inline std::vector<std::string> NamePool;
+
+	// Counts GetName calls, so the test can tell cached paths from rebuilt ones
+	inline std::atomic<uint64_t> GetNameCalls{ 0 };
+
+	class FName
+	{
+	public:
+		int32_t ComparisonIndex;
+		int32_t Number;
+
+		std::string ToString() const
+		{
+			std::string Name = NamePool[ComparisonIndex];
+			if (Number > 0)
+				Name += "_" + std::to_string(Number - 1);
+			return Name;
+		}
+	};
+
+	class UObject
+	{
+	public:
+		void* VTable;
+		int32_t Flags;
+		int32_t Index;
+		UClass* Class;
+		FName Name;
+		uint8_t Pad_24[0x4];
+		UObject* Outer;
+
+		static inline TUObjectArrayWrapper GObjects;
+
+		std::string GetName() const
+		{
+			GetNameCalls.fetch_add(1, std::memory_order_relaxed);
+			return Name.ToString();
+		}
+	};
+
+	class UClass : public UObject
+	{
+	public:
+		UClass* Super = nullptr;
+
+		bool IsSubclassOf(const UClass* Base) const
+		{
+			for (const UClass* Current = this; Current; Current = Current->Super)
+			{
+				if (Current == Base)
+					return true;
+			}
+			return false;
+		}
+	};
+}
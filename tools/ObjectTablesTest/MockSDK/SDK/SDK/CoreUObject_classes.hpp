@@ -0,0 +1,4 @@
+#pragma once
+
+// Everything the object tables use is in Basic.hpp
+#include "Basic.hpp"
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdio>
+
+// Stand-in for <Windows.h> off Windows: the export annotations PluginAPI.h puts on its
+// declarations, and debug output (to stderr here)
+#define __declspec(x)
+#define __cdecl
+
+inline void OutputDebugStringA(const char* Text)
+{
+	std::fputs(Text, stderr);
+}
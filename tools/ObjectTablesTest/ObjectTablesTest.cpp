@@ -0,0 +1,338 @@
+/**
+* ObjectTablesTest - checks the GObjects tables against brute-force scans of a mock GObjects
+*
+* Builds the base's real ClassInstanceIndex, ObjectNameTable and ObjectPathCache against the
+* mock SDK in MockSDK/ (chunked GObjects, FName into a name pool, a small class hierarchy), fills
+* GObjects with random objects and compares every answer with a scan of the whole array:
+*   ClassInstanceIndex   instances of a class, with and without subclasses (the Object Browser's
+*                        class filter and the Memory Report's per-class walk build on this)
+*   ObjectNameTable      case-insensitive name lookups (the Object Browser's search)
+*   ObjectPathCache      outer / asset paths, including after renames and reparenting
+* Each table is checked after the initial build, after rounds of churn (objects destroyed,
+* created and slots reused) and after its background refresh picked up churn on its own.
+*
+* Build (Linux), from a checkout without the generated SDK (a real one next to the sources
+* would be picked up instead of the mock):
+*   g++ -std=c++20 -O2 -pthread -I tools/ObjectTablesTest/MockSDK \
+*       -I plugin_manager_base/Plugin_Manager_Base_SDK -o objecttablestest \
+*       tools/ObjectTablesTest/ObjectTablesTest.cpp \
+*       plugin_manager_base/Plugin_Manager_Base_SDK/ClassInstanceIndex.cpp \
+*       plugin_manager_base/Plugin_Manager_Base_SDK/ObjectNameTable.cpp \
+*       plugin_manager_base/Plugin_Manager_Base_SDK/ObjectPathCache.cpp
+*
+* Usage:
+*   objecttablestest [objects]      GObjects slots to fill (default 200000)
+*
+* Exits with 0 when every check passed, 1 otherwise.
+*/
+
+#include "ClassInstanceIndex.h"
+#include "ObjectNameTable.h"
+#include "ObjectPathCache.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	int g_Failures = 0;
+
+	void Check(bool bCondition, const char* What)
+	{
+		if (!bCondition)
+		{
+			std::printf("FAIL: %s\n", What);
+			++g_Failures;
+		}
+	}
+
+	bool EqualsIgnoreCase(const std::string& A, const std::string& B)
+	{
+		return A.size() == B.size() && std::equal(A.begin(), A.end(), B.begin(), [](char X, char Y)
+		{
+			return std::tolower(static_cast<unsigned char>(X)) == std::tolower(static_cast<unsigned char>(Y));
+		});
+	}
+
+	// Owns the mock GObjects array and every object placed in it
+	class MockObjects
+	{
+	public:
+		explicit MockObjects(int32_t Count)
+			: Random(7)
+		{
+			const int32_t Chunks = (Count + SDK::TUObjectArray::ElementsPerChunk - 1) / SDK::TUObjectArray::ElementsPerChunk;
+			ChunkPointers.resize(Chunks);
+			Items.resize(Chunks);
+			for (int32_t c = 0; c < Chunks; ++c)
+			{
+				Items[c].assign(SDK::TUObjectArray::ElementsPerChunk, SDK::FUObjectItem{});
+				ChunkPointers[c] = Items[c].data();
+			}
+
+			SDK::TUObjectArray& Array = SDK::UObject::GObjects.Array;
+			Array.Objects = ChunkPointers.data();
+			Array.NumElements = Count;
+			Array.MaxElements = Chunks * SDK::TUObjectArray::ElementsPerChunk;
+			Array.NumChunks = Chunks;
+			Array.MaxChunks = Chunks;
+
+			// Names differ in case between objects, as "Default__" / "default__" style names do
+			for (int i = 0; i < 2000; ++i)
+				SDK::NamePool.push_back((i % 2 ? "Actor" : "aCTOR") + std::to_string(i / 2));
+
+			// Base <- Derived <- MostDerived, and an unrelated class; the classes live in GObjects too
+			const char* ClassNames[] = { "Base", "Derived", "MostDerived", "Unrelated" };
+			for (int c = 0; c < 4; ++c)
+			{
+				Classes.push_back(&ClassStorage.emplace_back());
+				SDK::UClass* Class = Classes.back();
+				Class->Index = c;
+				Class->Name = { static_cast<int32_t>(SDK::NamePool.size()), 0 };
+				SDK::NamePool.push_back(ClassNames[c]);
+				Slot(c).Object = Class;
+			}
+			Classes[1]->Super = Classes[0];
+			Classes[2]->Super = Classes[1];
+
+			for (int32_t i = FirstObject(); i < Count; ++i)
+			{
+				if (Random() % 4)
+					Place(i);
+			}
+		}
+
+		int32_t FirstObject() const { return 4; }
+		int32_t Count() const { return SDK::UObject::GObjects->NumElements; }
+		const std::vector<SDK::UClass*>& GetClasses() const { return Classes; }
+
+		SDK::FUObjectItem& Slot(int32_t Index)
+		{
+			return Items[Index / SDK::TUObjectArray::ElementsPerChunk][Index % SDK::TUObjectArray::ElementsPerChunk];
+		}
+
+		// A new object in slot Index with a random class, name and (earlier) Outer
+		SDK::UObject* Place(int32_t Index)
+		{
+			SDK::UObject* Object = &ObjectStorage.emplace_back();
+			Object->Index = Index;
+			Object->Class = Classes[Random() % Classes.size()];
+			Object->Name = { static_cast<int32_t>(Random() % 2000), static_cast<int32_t>(Random() % 3) };
+			Object->Outer = nullptr;
+			if (Index > FirstObject() && Random() % 2)
+				Object->Outer = Slot(FirstObject() + static_cast<int32_t>(Random() % (Index - FirstObject()))).Object;
+			Slot(Index).Object = Object;
+			return Object;
+		}
+
+		// Destroys and creates objects at random slots; freed slots get reused. Destroyed objects
+		// stay allocated and may still be another object's Outer, like a stale read in game.
+		void Churn(int Operations)
+		{
+			for (int k = 0; k < Operations; ++k)
+			{
+				int32_t Index = FirstObject() + static_cast<int32_t>(Random() % (Count() - FirstObject()));
+				if (Slot(Index).Object && Random() % 2)
+					Slot(Index).Object = nullptr;
+				else
+					Place(Index);
+			}
+		}
+
+		// Live objects of Class (or a subclass), by scanning every slot
+		std::vector<SDK::UObject*> ScanInstances(const SDK::UClass* Class, bool bExactClassOnly)
+		{
+			std::vector<SDK::UObject*> Found;
+			for (int32_t i = FirstObject(); i < Count(); ++i)
+			{
+				SDK::UObject* Object = Slot(i).Object;
+				if (Object && (bExactClassOnly ? Object->Class == Class : Object->Class->IsSubclassOf(Class)))
+					Found.push_back(Object);
+			}
+			return Found;
+		}
+
+		// Live objects whose name equals Name, ignoring case, by scanning every slot
+		std::vector<SDK::UObject*> ScanNamed(const std::string& Name)
+		{
+			std::vector<SDK::UObject*> Found;
+			for (int32_t i = 0; i < Count(); ++i)
+			{
+				SDK::UObject* Object = Slot(i).Object;
+				if (Object && EqualsIgnoreCase(Object->Name.ToString(), Name))
+					Found.push_back(Object);
+			}
+			return Found;
+		}
+
+		std::mt19937& Rng() { return Random; }
+
+	private:
+		std::mt19937 Random;
+		std::vector<std::vector<SDK::FUObjectItem>> Items;
+		std::vector<SDK::FUObjectItem*> ChunkPointers;
+		std::deque<SDK::UClass> ClassStorage;
+		std::deque<SDK::UObject> ObjectStorage;
+		std::vector<SDK::UClass*> Classes;
+	};
+
+	std::vector<SDK::UObject*> Sorted(std::vector<SDK::UObject*> Objects)
+	{
+		std::sort(Objects.begin(), Objects.end());
+		return Objects;
+	}
+
+	void CheckInstanceIndex(MockObjects& Objects, const char* Stage)
+	{
+		char What[128];
+		for (SDK::UClass* Class : Objects.GetClasses())
+		{
+			for (bool bExact : { false, true })
+			{
+				std::vector<SDK::UObject*> Indexed;
+				ClassInstanceIndex::Get().GetInstances(Class, bExact, Indexed);
+				std::snprintf(What, sizeof(What), "%s: instances of %s%s match a scan", Stage,
+					Class->Name.ToString().c_str(), bExact ? " (exact)" : "");
+				Check(Sorted(Indexed) == Sorted(Objects.ScanInstances(Class, bExact)), What);
+			}
+		}
+	}
+
+	void CheckNameTable(MockObjects& Objects, const char* Stage)
+	{
+		char What[128];
+		for (int q = 0; q < 50; ++q)
+		{
+			SDK::FName Name = { static_cast<int32_t>(Objects.Rng()() % 2000), static_cast<int32_t>(Objects.Rng()() % 3) };
+			std::string Text = Name.ToString();
+			if (q % 2)
+				std::transform(Text.begin(), Text.end(), Text.begin(), [](unsigned char C) { return static_cast<char>(std::toupper(C)); });
+
+			std::vector<SDK::UObject*> Indexed;
+			ObjectNameTable::Get().FindObjects(Text, Indexed);
+			std::vector<SDK::UObject*> Scanned = Objects.ScanNamed(Text);
+			std::snprintf(What, sizeof(What), "%s: objects named %s match a scan", Stage, Text.c_str());
+			Check(Sorted(Indexed) == Sorted(Scanned), What);
+
+			SDK::FName Found;
+			std::snprintf(What, sizeof(What), "%s: FindName(%s) agrees with the scan", Stage, Text.c_str());
+			Check(ObjectNameTable::Get().FindName(Text, Found) == !Scanned.empty(), What);
+		}
+
+		std::vector<SDK::UObject*> None;
+		ObjectNameTable::Get().FindObjects("NoSuchName", None);
+		Check(None.empty(), "unknown names find nothing");
+	}
+
+	std::string ScanOuterPath(SDK::UObject* Object)
+	{
+		std::string Path;
+		for (SDK::UObject* Current = Object; Current; Current = Current->Outer)
+			Path = Path.empty() ? Current->Name.ToString() : Current->Name.ToString() + "." + Path;
+		return Path;
+	}
+
+	void CheckPathCache(MockObjects& Objects, const char* Stage)
+	{
+		char What[128];
+		int Mismatches = 0;
+		for (int32_t i = Objects.FirstObject(); i < Objects.Count(); i += 7)
+		{
+			SDK::UObject* Object = Objects.Slot(i).Object;
+			if (Object && ObjectPathCache::Get().GetOuterPath(Object) != ScanOuterPath(Object))
+				++Mismatches;
+		}
+		std::snprintf(What, sizeof(What), "%s: cached outer paths match the Outer chains (%d differ)", Stage, Mismatches);
+		Check(Mismatches == 0, What);
+	}
+
+	// Renaming or reparenting an object must show in its own path and every path below it
+	void CheckPathCacheEdits(MockObjects& Objects)
+	{
+		int32_t Base = Objects.Count() - 3;
+		SDK::UObject* Package = Objects.Place(Base);
+		SDK::UObject* Level = Objects.Place(Base + 1);
+		SDK::UObject* Actor = Objects.Place(Base + 2);
+		Package->Outer = nullptr;
+		Level->Outer = Package;
+		Actor->Outer = Level;
+		ObjectPathCache& Cache = ObjectPathCache::Get();
+
+		Check(Cache.GetOuterPath(Actor) == ScanOuterPath(Actor), "new chain: outer path");
+		Check(Cache.GetAssetPath(Actor) == "/" + Package->Name.ToString() + "/" + Level->Name.ToString() + "/" + Actor->Name.ToString(),
+			"new chain: asset path");
+
+		uint64_t Calls = SDK::GetNameCalls.load();
+		Cache.GetOuterPath(Actor);
+		Check(SDK::GetNameCalls.load() == Calls, "a cached path is not rebuilt");
+
+		Level->Name.Number += 1;
+		Check(Cache.GetOuterPath(Actor) == ScanOuterPath(Actor), "renamed Outer: child path follows");
+
+		Package->Name.ComparisonIndex = (Package->Name.ComparisonIndex + 1) % 2000;
+		Check(Cache.GetOuterPath(Level) == ScanOuterPath(Level), "renamed root: child path follows");
+		Check(Cache.GetOuterPath(Actor) == ScanOuterPath(Actor), "renamed root: grandchild path follows");
+
+		Actor->Outer = Package;
+		Check(Cache.GetOuterPath(Actor) == ScanOuterPath(Actor), "reparented object: path follows");
+	}
+}
+
+int main(int argc, char** argv)
+{
+	int32_t Count = argc > 1 ? std::atoi(argv[1]) : 200000;
+	if (Count < 1000)
+		Count = 1000;
+
+	MockObjects Objects(Count);
+	std::printf("%d GObjects slots\n", Count);
+
+	auto Start = std::chrono::steady_clock::now();
+	ClassInstanceIndex::Get().Refresh();
+	ObjectNameTable::Get().Refresh();
+	std::printf("index + name table built in %.0f ms, %zu names\n",
+		std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count(),
+		ObjectNameTable::Get().GetNameCount());
+
+	CheckInstanceIndex(Objects, "build");
+	CheckNameTable(Objects, "build");
+	CheckPathCache(Objects, "build");
+
+	for (int Round = 0; Round < 3; ++Round)
+	{
+		Objects.Churn(Count / 20);
+		ClassInstanceIndex::Get().Refresh();
+		ObjectNameTable::Get().Refresh();
+		CheckInstanceIndex(Objects, "churn");
+		CheckNameTable(Objects, "churn");
+		CheckPathCache(Objects, "churn");
+	}
+
+	// Background refresh picks up churn on its own
+	Objects.Churn(Count / 20);
+	ClassInstanceIndex::Get().StartAutoRefresh(10);
+	ObjectNameTable::Get().StartAutoRefresh(10);
+	std::this_thread::sleep_for(std::chrono::milliseconds(500));
+	ClassInstanceIndex::Get().StopAutoRefresh();
+	ObjectNameTable::Get().StopAutoRefresh();
+	CheckInstanceIndex(Objects, "auto refresh");
+	CheckNameTable(Objects, "auto refresh");
+
+	CheckPathCacheEdits(Objects);
+
+	if (g_Failures > 0)
+	{
+		std::printf("%d check(s) failed\n", g_Failures);
+		return 1;
+	}
+	std::printf("OK\n");
+	return 0;
+}
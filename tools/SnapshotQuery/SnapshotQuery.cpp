@@ -0,0 +1,634 @@
+/**
+* SnapshotQuery - offline queries over a binary GObjects snapshot (.bos)
+*
+* The snapshot is written by the plugin manager ([ObjectDump] Snapshot=true) and mapped here
+* as is: every query is a scan over one or two packed columns (SSE2, four rows per compare),
+* with the name table only consulted to turn text into name ids and ids back into text.
+*
+* Build (Linux):
+*   g++ -std=c++20 -O2 -o snapshotquery tools/SnapshotQuery/SnapshotQuery.cpp
+*
+* Usage:
+*   snapshotquery info      <snapshot>                          counts and layout
+*   snapshotquery classes   <snapshot> [--limit N]              instance count per class
+*   snapshotquery instances <snapshot> <Class> [--limit N]      objects of exactly that class
+*   snapshotquery children  <snapshot> <Index|Name> [--limit N] objects whose Outer is that object
+*   snapshotquery find      <snapshot> <Text> [--exact] [--limit N]  name search (case-insensitive)
+*   snapshotquery merge     <out> <full> <delta>...             apply a delta chain, write a full snapshot
+*
+* Object rows print as: <Index>\t0x<Address>\t<Class>\t<Outer...>.<Name>
+*
+* On a delta snapshot the queries run over the objects it records as created or changed; classes
+* and Outers that didn't change print as #<Index>. Merge a delta onto its chain for full answers.
+* The merged file keeps the last delta's id, so later deltas of the same session apply to it too.
+*/
+
+#include "../../plugin_manager_base/Plugin_Manager_Base_SDK/ObjectSnapshotFormat.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	using namespace ObjectSnapshotFormat;
+
+	// Key sets up to this size are compared in registers; larger ones go through a bitmap
+	constexpr size_t MaxVectorKeys = 8;
+	constexpr int MaxOuterDepth = 64;
+
+	// ===== Snapshot file =====
+
+	struct Snapshot
+	{
+		const uint8_t* Data = nullptr;
+		size_t Size = 0;
+		FileHeader Header{};
+
+		const int32_t* Index = nullptr;
+		const int32_t* Class = nullptr;
+		const int32_t* Outer = nullptr;
+		const uint32_t* Name = nullptr;
+		const uint32_t* Flags = nullptr;
+		const uint64_t* Address = nullptr;
+		const int32_t* Removed = nullptr;
+		const uint32_t* NameOffsets = nullptr;
+		const char* NameData = nullptr;
+
+		~Snapshot()
+		{
+			if (Data)
+				munmap(const_cast<uint8_t*>(Data), Size);
+		}
+
+		uint32_t Count() const { return Header.ObjectCount; }
+		bool IsDelta() const { return Header.Kind == KindDelta; }
+
+		std::string_view NameOf(uint32_t NameId) const
+		{
+			if (NameId >= Header.NameCount)
+				return "<bad name>";
+			return std::string_view(NameData + NameOffsets[NameId], NameOffsets[NameId + 1] - NameOffsets[NameId]);
+		}
+
+		// Row of a GObjects index (rows are sorted by index), or -1
+		int64_t RowOf(int32_t ObjectIndex) const
+		{
+			if (ObjectIndex < 0)
+				return -1;
+			const int32_t* It = std::lower_bound(Index, Index + Count(), ObjectIndex);
+			return (It != Index + Count() && *It == ObjectIndex) ? It - Index : -1;
+		}
+	};
+
+	bool OpenSnapshot(const std::string& Path, Snapshot& Snap)
+	{
+		struct stat St;
+		int Fd = open(Path.c_str(), O_RDONLY);
+		if (Fd < 0 || fstat(Fd, &St) != 0)
+		{
+			fprintf(stderr, "snapshotquery: cannot open %s\n", Path.c_str());
+			if (Fd >= 0)
+				close(Fd);
+			return false;
+		}
+
+		Snap.Size = static_cast<size_t>(St.st_size);
+		if (Snap.Size < FileHeaderV1Size)
+		{
+			close(Fd);
+			fprintf(stderr, "snapshotquery: %s is not a snapshot\n", Path.c_str());
+			return false;
+		}
+
+		void* Mapping = mmap(nullptr, Snap.Size, PROT_READ, MAP_PRIVATE, Fd, 0);
+		close(Fd);
+		if (Mapping == MAP_FAILED)
+		{
+			fprintf(stderr, "snapshotquery: cannot map %s\n", Path.c_str());
+			return false;
+		}
+		Snap.Data = static_cast<const uint8_t*>(Mapping);
+		std::memcpy(&Snap.Header, Snap.Data, (std::min)(Snap.Size, sizeof(FileHeader)));
+
+		// Version 1 headers end at FileSize; what follows them is padding and column data
+		FileHeader& H = Snap.Header;
+		if (H.Version == 1)
+		{
+			H.Kind = KindFull;
+			H.RemovedCount = 0;
+			H.RemovedOffset = 0;
+			H.SnapshotId = 0;
+			H.BaseId = 0;
+		}
+
+		bool bValid = std::memcmp(H.Magic, FileMagic, sizeof(FileMagic)) == 0 && H.Version >= 1 && H.Version <= FileVersion &&
+			(H.Version == 1 || Snap.Size >= sizeof(FileHeader)) && H.FileSize <= Snap.Size &&
+			H.NameOffsetsOffset + (static_cast<uint64_t>(H.NameCount) + 1) * sizeof(uint32_t) <= Snap.Size &&
+			H.NameDataOffset + H.NameDataSize <= Snap.Size &&
+			(H.RemovedCount == 0 || H.RemovedOffset + static_cast<uint64_t>(H.RemovedCount) * sizeof(int32_t) <= Snap.Size);
+		for (uint32_t c = 0; bValid && c < ColumnCount; ++c)
+			bValid = H.ColumnOffsets[c] % ColumnAlignment == 0 && H.ColumnOffsets[c] + static_cast<uint64_t>(H.ObjectCount) * ColumnElementSize[c] <= Snap.Size;
+		if (!bValid)
+		{
+			fprintf(stderr, "snapshotquery: %s is not a valid snapshot (version %u)\n", Path.c_str(), H.Version);
+			return false;
+		}
+
+		Snap.Index = reinterpret_cast<const int32_t*>(Snap.Data + H.ColumnOffsets[ColumnIndex]);
+		Snap.Class = reinterpret_cast<const int32_t*>(Snap.Data + H.ColumnOffsets[ColumnClass]);
+		Snap.Outer = reinterpret_cast<const int32_t*>(Snap.Data + H.ColumnOffsets[ColumnOuter]);
+		Snap.Name = reinterpret_cast<const uint32_t*>(Snap.Data + H.ColumnOffsets[ColumnName]);
+		Snap.Flags = reinterpret_cast<const uint32_t*>(Snap.Data + H.ColumnOffsets[ColumnFlags]);
+		Snap.Address = reinterpret_cast<const uint64_t*>(Snap.Data + H.ColumnOffsets[ColumnAddress]);
+		Snap.Removed = reinterpret_cast<const int32_t*>(Snap.Data + H.RemovedOffset);
+		Snap.NameOffsets = reinterpret_cast<const uint32_t*>(Snap.Data + H.NameOffsetsOffset);
+		Snap.NameData = reinterpret_cast<const char*>(Snap.Data + H.NameDataOffset);
+		return true;
+	}
+
+	// ===== Column scans =====
+
+	// Rows whose 32-bit column value is one of Keys, appended in row order
+	void ScanEquals(const uint32_t* Column, uint32_t Count, const std::vector<uint32_t>& Keys, std::vector<uint32_t>& Rows)
+	{
+		if (Keys.empty())
+			return;
+
+		if (Keys.size() > MaxVectorKeys)
+		{
+			uint32_t MaxKey = *std::max_element(Keys.begin(), Keys.end());
+			std::vector<uint8_t> Wanted(static_cast<size_t>(MaxKey) + 1, 0);
+			for (uint32_t Key : Keys)
+				Wanted[Key] = 1;
+			for (uint32_t Row = 0; Row < Count; ++Row)
+			{
+				if (Column[Row] <= MaxKey && Wanted[Column[Row]])
+					Rows.push_back(Row);
+			}
+			return;
+		}
+
+		uint32_t Row = 0;
+#if defined(__SSE2__)
+		__m128i KeyVectors[MaxVectorKeys];
+		for (size_t k = 0; k < Keys.size(); ++k)
+			KeyVectors[k] = _mm_set1_epi32(static_cast<int>(Keys[k]));
+
+		for (; Row + 4 <= Count; Row += 4)
+		{
+			// Columns are 64-byte aligned in the file, and so in the mapping
+			__m128i Values = _mm_load_si128(reinterpret_cast<const __m128i*>(Column + Row));
+			__m128i Hits = _mm_cmpeq_epi32(Values, KeyVectors[0]);
+			for (size_t k = 1; k < Keys.size(); ++k)
+				Hits = _mm_or_si128(Hits, _mm_cmpeq_epi32(Values, KeyVectors[k]));
+
+			int Mask = _mm_movemask_ps(_mm_castsi128_ps(Hits));
+			while (Mask)
+			{
+				int Lane = __builtin_ctz(static_cast<unsigned>(Mask));
+				Rows.push_back(Row + Lane);
+				Mask &= Mask - 1;
+			}
+		}
+#endif
+		for (; Row < Count; ++Row)
+		{
+			if (std::find(Keys.begin(), Keys.end(), Column[Row]) != Keys.end())
+				Rows.push_back(Row);
+		}
+	}
+
+	void ScanEquals(const int32_t* Column, uint32_t Count, const std::vector<int32_t>& Keys, std::vector<uint32_t>& Rows)
+	{
+		// Index columns hold no negative keys worth searching for (NoIndex is "none")
+		std::vector<uint32_t> UnsignedKeys;
+		for (int32_t Key : Keys)
+		{
+			if (Key >= 0)
+				UnsignedKeys.push_back(static_cast<uint32_t>(Key));
+		}
+		ScanEquals(reinterpret_cast<const uint32_t*>(Column), Count, UnsignedKeys, Rows);
+	}
+
+	// ===== Name lookup =====
+
+	bool ContainsIgnoreCase(std::string_view Text, std::string_view Needle)
+	{
+		return std::search(Text.begin(), Text.end(), Needle.begin(), Needle.end(),
+			[](char A, char B) { return std::tolower(static_cast<unsigned char>(A)) == std::tolower(static_cast<unsigned char>(B)); }) != Text.end();
+	}
+
+	bool EqualsIgnoreCase(std::string_view A, std::string_view B)
+	{
+		return A.size() == B.size() && ContainsIgnoreCase(A, B);
+	}
+
+	std::vector<uint32_t> FindNameIds(const Snapshot& Snap, std::string_view Text, bool bExact)
+	{
+		std::vector<uint32_t> Ids;
+		for (uint32_t Id = 0; Id < Snap.Header.NameCount; ++Id)
+		{
+			std::string_view Name = Snap.NameOf(Id);
+			if (bExact ? EqualsIgnoreCase(Name, Text) : ContainsIgnoreCase(Name, Text))
+				Ids.push_back(Id);
+		}
+		return Ids;
+	}
+
+	// GObjects indices of the objects named Name
+	std::vector<int32_t> ObjectsNamed(const Snapshot& Snap, std::string_view Name)
+	{
+		std::vector<uint32_t> Rows;
+		ScanEquals(Snap.Name, Snap.Count(), FindNameIds(Snap, Name, true), Rows);
+
+		std::vector<int32_t> Indices;
+		for (uint32_t Row : Rows)
+			Indices.push_back(Snap.Index[Row]);
+		return Indices;
+	}
+
+	// ===== Output =====
+
+	// Name of the object at a GObjects index, "#<Index>" if it isn't in this file
+	std::string ObjectName(const Snapshot& Snap, int32_t ObjectIndex)
+	{
+		if (ObjectIndex == NoIndex)
+			return "None";
+		int64_t Row = Snap.RowOf(ObjectIndex);
+		return Row >= 0 ? std::string(Snap.NameOf(Snap.Name[Row])) : "#" + std::to_string(ObjectIndex);
+	}
+
+	std::string ClassNameOf(const Snapshot& Snap, uint32_t Row)
+	{
+		return ObjectName(Snap, Snap.Class[Row]);
+	}
+
+	std::string PathOf(const Snapshot& Snap, uint32_t Row)
+	{
+		std::vector<std::string> Parts;
+		int64_t Current = Row;
+		for (int Depth = 0; Current >= 0 && Depth < MaxOuterDepth; ++Depth)
+		{
+			Parts.emplace_back(Snap.NameOf(Snap.Name[Current]));
+			int32_t Outer = Snap.Outer[Current];
+			Current = Snap.RowOf(Outer);
+			if (Current < 0 && Outer != NoIndex)
+				Parts.push_back("#" + std::to_string(Outer));
+		}
+
+		std::string Path;
+		for (auto It = Parts.rbegin(); It != Parts.rend(); ++It)
+		{
+			if (!Path.empty())
+				Path += '.';
+			Path += *It;
+		}
+		return Path;
+	}
+
+	void PrintRows(const Snapshot& Snap, const std::vector<uint32_t>& Rows, size_t Limit)
+	{
+		size_t Shown = (std::min)(Rows.size(), Limit);
+		for (size_t i = 0; i < Shown; ++i)
+		{
+			uint32_t Row = Rows[i];
+			printf("%d\t0x%llX\t%s\t%s\n", Snap.Index[Row], static_cast<unsigned long long>(Snap.Address[Row]),
+				ClassNameOf(Snap, Row).c_str(), PathOf(Snap, Row).c_str());
+		}
+		if (Shown < Rows.size())
+			fprintf(stderr, "snapshotquery: %zu of %zu rows shown (--limit)\n", Shown, Rows.size());
+		else
+			fprintf(stderr, "snapshotquery: %zu rows\n", Rows.size());
+	}
+
+	// ===== Commands =====
+
+	int CommandInfo(const Snapshot& Snap)
+	{
+		const FileHeader& H = Snap.Header;
+		printf("Version:   %u\n", H.Version);
+		printf("Timestamp: %lld\n", static_cast<long long>(H.Timestamp));
+		printf("Objects:   %u\n", H.ObjectCount);
+		printf("Names:     %u (%llu bytes)\n", H.NameCount, static_cast<unsigned long long>(H.NameDataSize));
+		printf("File size: %llu bytes\n", static_cast<unsigned long long>(H.FileSize));
+		printf("Kind:      %s\n", Snap.IsDelta() ? "delta" : "full");
+		printf("Id:        %016llx\n", static_cast<unsigned long long>(H.SnapshotId));
+		if (Snap.IsDelta())
+		{
+			printf("Base id:   %016llx\n", static_cast<unsigned long long>(H.BaseId));
+			printf("Removed:   %u\n", H.RemovedCount);
+		}
+		return 0;
+	}
+
+	int CommandClasses(const Snapshot& Snap, size_t Limit)
+	{
+		// Histogram over the class column
+		std::unordered_map<int32_t, uint32_t> Counts;
+		for (uint32_t Row = 0; Row < Snap.Count(); ++Row)
+			++Counts[Snap.Class[Row]];
+
+		std::vector<std::pair<int32_t, uint32_t>> Sorted(Counts.begin(), Counts.end());
+		std::sort(Sorted.begin(), Sorted.end(), [](const auto& A, const auto& B) { return A.second > B.second; });
+
+		size_t Shown = (std::min)(Sorted.size(), Limit);
+		for (size_t i = 0; i < Shown; ++i)
+		{
+			std::string Name = Sorted[i].first == NoIndex ? "<no class>" : ObjectName(Snap, Sorted[i].first);
+			printf("%10u  %s\n", Sorted[i].second, Name.c_str());
+		}
+		return 0;
+	}
+
+	int CommandInstances(const Snapshot& Snap, const std::string& ClassName, size_t Limit)
+	{
+		std::vector<int32_t> Classes = ObjectsNamed(Snap, ClassName);
+		if (Classes.empty())
+		{
+			fprintf(stderr, "snapshotquery: no object named %s\n", ClassName.c_str());
+			return 1;
+		}
+
+		std::vector<uint32_t> Rows;
+		ScanEquals(Snap.Class, Snap.Count(), Classes, Rows);
+		PrintRows(Snap, Rows, Limit);
+		return 0;
+	}
+
+	int CommandChildren(const Snapshot& Snap, const std::string& Target, size_t Limit)
+	{
+		std::vector<int32_t> Outers;
+		char* End = nullptr;
+		long Value = std::strtol(Target.c_str(), &End, 10);
+		if (!Target.empty() && *End == '\0')
+			Outers.push_back(static_cast<int32_t>(Value));
+		else
+			Outers = ObjectsNamed(Snap, Target);
+
+		if (Outers.empty())
+		{
+			fprintf(stderr, "snapshotquery: no object named %s\n", Target.c_str());
+			return 1;
+		}
+
+		std::vector<uint32_t> Rows;
+		ScanEquals(Snap.Outer, Snap.Count(), Outers, Rows);
+		PrintRows(Snap, Rows, Limit);
+		return 0;
+	}
+
+	int CommandFind(const Snapshot& Snap, const std::string& Text, bool bExact, size_t Limit)
+	{
+		std::vector<uint32_t> Rows;
+		ScanEquals(Snap.Name, Snap.Count(), FindNameIds(Snap, Text, bExact), Rows);
+		PrintRows(Snap, Rows, Limit);
+		return 0;
+	}
+
+	// ===== Merge =====
+
+	struct MergedObject
+	{
+		bool bLive = false;
+		int32_t Class = NoIndex;
+		int32_t Outer = NoIndex;
+		uint32_t Flags = 0;
+		uint64_t Address = 0;
+		std::string_view Name;      // points into one of the mapped inputs
+	};
+
+	void ApplySnapshot(const Snapshot& Snap, std::vector<MergedObject>& Table)
+	{
+		for (uint32_t i = 0; i < Snap.Header.RemovedCount; ++i)
+		{
+			int32_t Index = Snap.Removed[i];
+			if (Index >= 0 && static_cast<size_t>(Index) < Table.size())
+				Table[Index].bLive = false;
+		}
+
+		for (uint32_t Row = 0; Row < Snap.Count(); ++Row)
+		{
+			int32_t Index = Snap.Index[Row];
+			if (Index < 0)
+				continue;
+			if (static_cast<size_t>(Index) >= Table.size())
+				Table.resize(static_cast<size_t>(Index) + 1);
+			Table[Index] = { true, Snap.Class[Row], Snap.Outer[Row], Snap.Flags[Row], Snap.Address[Row], Snap.NameOf(Snap.Name[Row]) };
+		}
+	}
+
+	bool WriteMerged(const std::string& Path, const std::vector<MergedObject>& Table, const FileHeader& Last)
+	{
+		std::vector<int32_t> Index, Class, Outer;
+		std::vector<uint32_t> Name, Flags;
+		std::vector<uint64_t> Address;
+		std::unordered_map<std::string_view, uint32_t> NameIds;
+		std::vector<std::string_view> Names;
+
+		for (size_t i = 0; i < Table.size(); ++i)
+		{
+			const MergedObject& Object = Table[i];
+			if (!Object.bLive)
+				continue;
+			auto [It, bInserted] = NameIds.try_emplace(Object.Name, static_cast<uint32_t>(Names.size()));
+			if (bInserted)
+				Names.push_back(Object.Name);
+
+			Index.push_back(static_cast<int32_t>(i));
+			Class.push_back(Object.Class);
+			Outer.push_back(Object.Outer);
+			Name.push_back(It->second);
+			Flags.push_back(Object.Flags);
+			Address.push_back(Object.Address);
+		}
+
+		FileHeader Header{};
+		std::memcpy(Header.Magic, FileMagic, sizeof(FileMagic));
+		Header.Version = FileVersion;
+		Header.Timestamp = Last.Timestamp;
+		Header.ObjectCount = static_cast<uint32_t>(Index.size());
+		Header.NameCount = static_cast<uint32_t>(Names.size());
+		Header.Kind = KindFull;
+		Header.SnapshotId = Last.SnapshotId;
+
+		uint64_t Offset = AlignUp(sizeof(FileHeader));
+		for (uint32_t c = 0; c < ColumnCount; ++c)
+		{
+			Header.ColumnOffsets[c] = Offset;
+			Offset = AlignUp(Offset + Index.size() * ColumnElementSize[c]);
+		}
+		Header.RemovedOffset = Offset;
+
+		std::vector<uint32_t> NameOffsets;
+		uint64_t NameDataSize = 0;
+		for (std::string_view Text : Names)
+		{
+			NameOffsets.push_back(static_cast<uint32_t>(NameDataSize));
+			NameDataSize += Text.size();
+		}
+		NameOffsets.push_back(static_cast<uint32_t>(NameDataSize));
+
+		Header.NameOffsetsOffset = Offset;
+		Header.NameDataOffset = AlignUp(Offset + NameOffsets.size() * sizeof(uint32_t));
+		Header.NameDataSize = NameDataSize;
+		Header.FileSize = Header.NameDataOffset + NameDataSize;
+
+		std::string TempPath = Path + ".tmp";
+		FILE* File = fopen(TempPath.c_str(), "wb");
+		if (!File)
+			return false;
+
+		// Sections in file order, zero padding up to each aligned offset
+		uint64_t Written = 0;
+		auto WriteAt = [&](uint64_t Offset, const void* Data, size_t Size)
+		{
+			static const char Zeros[ColumnAlignment] = {};
+			for (; Written < Offset; ++Written)
+				fwrite(Zeros, 1, 1, File);
+			fwrite(Data, 1, Size, File);
+			Written += Size;
+		};
+
+		WriteAt(0, &Header, sizeof(Header));
+		WriteAt(Header.ColumnOffsets[ColumnIndex], Index.data(), Index.size() * sizeof(int32_t));
+		WriteAt(Header.ColumnOffsets[ColumnClass], Class.data(), Class.size() * sizeof(int32_t));
+		WriteAt(Header.ColumnOffsets[ColumnOuter], Outer.data(), Outer.size() * sizeof(int32_t));
+		WriteAt(Header.ColumnOffsets[ColumnName], Name.data(), Name.size() * sizeof(uint32_t));
+		WriteAt(Header.ColumnOffsets[ColumnFlags], Flags.data(), Flags.size() * sizeof(uint32_t));
+		WriteAt(Header.ColumnOffsets[ColumnAddress], Address.data(), Address.size() * sizeof(uint64_t));
+		WriteAt(Header.NameOffsetsOffset, NameOffsets.data(), NameOffsets.size() * sizeof(uint32_t));
+		WriteAt(Header.NameDataOffset, nullptr, 0);
+		for (std::string_view Text : Names)
+			WriteAt(Written, Text.data(), Text.size());
+
+		bool bOk = ferror(File) == 0;
+		bOk = (fclose(File) == 0) && bOk;
+		if (!bOk || rename(TempPath.c_str(), Path.c_str()) != 0)
+		{
+			unlink(TempPath.c_str());
+			return false;
+		}
+		printf("%u objects, %u names -> %s\n", Header.ObjectCount, Header.NameCount, Path.c_str());
+		return true;
+	}
+
+	int CommandMerge(const std::string& OutPath, const std::vector<std::string>& Inputs)
+	{
+		// Inputs stay mapped until the merged file is written; names point into them
+		std::vector<Snapshot> Chain(Inputs.size());
+		for (size_t i = 0; i < Inputs.size(); ++i)
+		{
+			if (!OpenSnapshot(Inputs[i], Chain[i]))
+				return 1;
+		}
+
+		if (Chain[0].IsDelta())
+		{
+			fprintf(stderr, "snapshotquery: %s is a delta, the chain must start with a full snapshot\n", Inputs[0].c_str());
+			return 2;
+		}
+		for (size_t i = 1; i < Chain.size(); ++i)
+		{
+			const FileHeader& Previous = Chain[i - 1].Header;
+			if (!Chain[i].IsDelta() || Previous.SnapshotId == 0 || Chain[i].Header.BaseId != Previous.SnapshotId)
+			{
+				fprintf(stderr, "snapshotquery: %s does not apply to %s\n", Inputs[i].c_str(), Inputs[i - 1].c_str());
+				return 2;
+			}
+		}
+
+		std::vector<MergedObject> Table;
+		for (const Snapshot& Snap : Chain)
+			ApplySnapshot(Snap, Table);
+
+		if (!WriteMerged(OutPath, Table, Chain.back().Header))
+		{
+			fprintf(stderr, "snapshotquery: cannot write %s\n", OutPath.c_str());
+			return 1;
+		}
+		return 0;
+	}
+
+	void PrintUsage()
+	{
+		fprintf(stderr,
+			"usage:\n"
+			"  snapshotquery info      <snapshot>\n"
+			"  snapshotquery classes   <snapshot> [--limit N]\n"
+			"  snapshotquery instances <snapshot> <Class> [--limit N]\n"
+			"  snapshotquery children  <snapshot> <Index|Name> [--limit N]\n"
+			"  snapshotquery find      <snapshot> <Text> [--exact] [--limit N]\n"
+			"  snapshotquery merge     <out> <full> <delta>...\n");
+	}
+}
+
+int main(int Argc, char** Argv)
+{
+	if (Argc < 3)
+	{
+		PrintUsage();
+		return 2;
+	}
+
+	std::string Command = Argv[1];
+	std::string SnapshotPath = Argv[2];
+
+	std::vector<std::string> Positional;
+	size_t Limit = SIZE_MAX;
+	bool bExact = false;
+	for (int i = 3; i < Argc; ++i)
+	{
+		std::string Arg = Argv[i];
+		if (Arg == "--limit" && i + 1 < Argc)
+			Limit = std::strtoull(Argv[++i], nullptr, 10);
+		else if (Arg == "--exact")
+			bExact = true;
+		else
+			Positional.push_back(Arg);
+	}
+
+	if (Command == "merge")
+	{
+		if (Positional.empty())
+		{
+			PrintUsage();
+			return 2;
+		}
+		return CommandMerge(SnapshotPath, Positional);
+	}
+
+	Snapshot Snap;
+	if (!OpenSnapshot(SnapshotPath, Snap))
+		return 1;
+
+	if (Command == "info")
+		return CommandInfo(Snap);
+	if (Command == "classes")
+		return CommandClasses(Snap, Limit);
+	if (Command == "instances" && !Positional.empty())
+		return CommandInstances(Snap, Positional[0], Limit);
+	if (Command == "children" && !Positional.empty())
+		return CommandChildren(Snap, Positional[0], Limit);
+	if (Command == "find" && !Positional.empty())
+		return CommandFind(Snap, Positional[0], bExact, Limit);
+
+	PrintUsage();
+	return 2;
+}